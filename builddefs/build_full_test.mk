@@ -19,6 +19,7 @@ $(TEST_OUTPUT)_INC := \
 $(TEST_OUTPUT)_SRC := \
 	$(QUANTUM_SRC) \
 	$(SRC) \
+	$(QUANTUM_LIB_SRC) \
 	$(QUANTUM_PATH)/keymap_introspection.c \
 	tests/test_common/matrix.c \
 	tests/test_common/pointing_device_driver.c \
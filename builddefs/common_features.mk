@@ -45,6 +45,12 @@ else ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), api)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
 endif
 
+ifeq ($(strip $(LATENCY_TRACE_ENABLE)), yes)
+    PROFILER_ENABLE := yes
+    OPT_DEFS += -DLATENCY_TRACE_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/latency_trace.c
+endif
+
 AUDIO_ENABLE ?= no
 ifeq ($(strip $(AUDIO_ENABLE)), yes)
     ifeq ($(PLATFORM),CHIBIOS)
@@ -34,6 +34,7 @@ GENERIC_FEATURES = \
     DYNAMIC_TAPPING_TERM \
     GRAVE_ESC \
     HAPTIC \
+    IDLE_SCHEDULER \
     KEY_LOCK \
     KEY_OVERRIDE \
     LAYER_LOCK \
@@ -42,6 +43,7 @@ GENERIC_FEATURES = \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILER \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
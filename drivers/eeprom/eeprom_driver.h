@@ -22,3 +22,8 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+// Only needed by drivers which defer writes, the defaults do nothing
+void eeprom_driver_flush(void);
+void eeprom_driver_task(void);
+bool eeprom_driver_flush_pending(void);
@@ -6,6 +6,20 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+#    include "timer.h"
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        include "idle_scheduler.h"
+#    endif
+
+#    ifndef WEAR_LEVELING_FLUSH_MAX_DELAY
+#        define WEAR_LEVELING_FLUSH_MAX_DELAY 5000
+#    endif
+
+static uint32_t first_write_time = 0;
+static uint32_t last_write_time  = 0;
+#endif // WEAR_LEVELING_FLUSH_DELAY
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -21,9 +35,51 @@ void eeprom_driver_erase(void) {
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    wear_leveling_read((uint32_t)addr, buf, len);
+    wear_leveling_read((uint32_t)(uintptr_t)addr, buf, len);
 }
 
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    wear_leveling_write((uint32_t)addr, buf, len);
+    uint32_t now = timer_read32();
+    if (!wear_leveling_flush_pending()) {
+        first_write_time = now;
+    }
+    last_write_time = now;
+    wear_leveling_write_deferred((uint32_t)(uintptr_t)addr, buf, len);
 }
+
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+void eeprom_driver_task(void) {
+    // Flush once writes have stopped for a while, or have kept coming for too long
+    if (!wear_leveling_flush_pending()) {
+        return;
+    }
+
+    if (timer_elapsed32(last_write_time) >= (WEAR_LEVELING_FLUSH_DELAY) || timer_elapsed32(first_write_time) >= (WEAR_LEVELING_FLUSH_MAX_DELAY)) {
+        wear_leveling_flush();
+        return;
+    }
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+    // Whichever deadline comes first
+    uint32_t deadline     = last_write_time + (WEAR_LEVELING_FLUSH_DELAY);
+    uint32_t max_deadline = first_write_time + (WEAR_LEVELING_FLUSH_MAX_DELAY);
+    idle_scheduler_wake_at(timer_expired32(max_deadline, deadline) ? deadline : max_deadline);
+#    endif
+}
+
+bool eeprom_driver_flush_pending(void) {
+    return wear_leveling_flush_pending();
+}
+
+#else
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    wear_leveling_write((uint32_t)(uintptr_t)addr, buf, len);
+}
+
+#endif // WEAR_LEVELING_FLUSH_DELAY
@@ -138,4 +138,24 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+#if defined(I2C_STATS_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Counters of the I2C traffic, as returned by i2c_get_stats().
+ */
+typedef struct i2c_stats_t {
+    uint32_t transfers; // calls to the transmit, receive and register functions, including failed ones
+    uint32_t bytes;     // data and register address bytes, not counting the device address
+} i2c_stats_t;
+
+/**
+ * \brief Get the I2C traffic since startup, or since the last call to i2c_clear_stats(). Requires `I2C_STATS_ENABLE`.
+ */
+i2c_stats_t i2c_get_stats(void);
+
+/**
+ * \brief Reset the I2C traffic counters. Requires `I2C_STATS_ENABLE`.
+ */
+void i2c_clear_stats(void);
+#endif // defined(I2C_STATS_ENABLE) || defined(__DOXYGEN__)
+
 /** \} */
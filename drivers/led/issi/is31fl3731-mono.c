@@ -21,8 +21,13 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "is31fl37xx_chunks.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
+#define IS31FL3731_PWM_CHUNK_SIZE 16
+
+_Static_assert(IS31FL37XX_CHUNK_COUNT(IS31FL3731_PWM_REGISTER_COUNT, IS31FL3731_PWM_CHUNK_SIZE) <= IS31FL37XX_MAX_CHUNKS, "IS31FL3731_PWM_CHUNK_SIZE is too small for the PWM buffer to fit the dirty mask");
+
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
 
 #ifndef IS31FL3731_I2C_TIMEOUT
@@ -52,15 +57,15 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3731_driver_t {
-    uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t             pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    is31fl37xx_chunks_t pwm_buffer_dirty;
+    uint8_t             led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
+    bool                led_control_buffer_dirty;
 } PACKED is31fl3731_driver_t;
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -79,20 +84,14 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
     is31fl3731_write_register(index, IS31FL3731_REG_COMMAND, page);
 }
 
-void is31fl3731_write_pwm_buffer(uint8_t index) {
+static void is31fl3731_write_pwm_chunks(uint8_t index, is31fl37xx_chunks_t chunks) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Transmit PWM registers in up to 9 transfers of 16 bytes.
+    is31fl37xx_write_chunks(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM, driver_buffers[index].pwm_buffer, IS31FL3731_PWM_REGISTER_COUNT, IS31FL3731_PWM_CHUNK_SIZE, chunks, IS31FL3731_I2C_PERSISTENCE, IS31FL3731_I2C_TIMEOUT);
+}
 
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
-#if IS31FL3731_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
-#endif
-    }
+void is31fl3731_write_pwm_buffer(uint8_t index) {
+    is31fl3731_write_pwm_chunks(index, IS31FL37XX_ALL_CHUNKS);
 }
 
 void is31fl3731_init_drivers(void) {
@@ -179,7 +178,7 @@ void is31fl3731_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= IS31FL37XX_CHUNK(led.v, IS31FL3731_PWM_CHUNK_SIZE);
     }
 }
 
@@ -207,9 +206,9 @@ void is31fl3731_set_led_control_register(uint8_t index, bool value) {
 
 void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3731_write_pwm_buffer(index);
+        is31fl3731_write_pwm_chunks(index, driver_buffers[index].pwm_buffer_dirty);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
@@ -21,9 +21,18 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "is31fl37xx_chunks.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
+#define IS31FL3741_PWM_0_CHUNK_SIZE 30
+#define IS31FL3741_PWM_1_CHUNK_SIZE 19
+// The chunks of both PWM pages share a mask, with those of page 1 starting at this bit
+#define IS31FL3741_PWM_1_CHUNK_SHIFT 8
+
+_Static_assert(IS31FL37XX_CHUNK_COUNT(IS31FL3741_PWM_0_REGISTER_COUNT, IS31FL3741_PWM_0_CHUNK_SIZE) <= IS31FL3741_PWM_1_CHUNK_SHIFT, "IS31FL3741_PWM_0_CHUNK_SIZE is too small for the first PWM page to fit below the second in the dirty mask");
+_Static_assert(IS31FL3741_PWM_1_CHUNK_SHIFT + IS31FL37XX_CHUNK_COUNT(IS31FL3741_PWM_1_REGISTER_COUNT, IS31FL3741_PWM_1_CHUNK_SIZE) <= IS31FL37XX_MAX_CHUNKS, "IS31FL3741_PWM_1_CHUNK_SIZE is too small for the second PWM page to fit the dirty mask");
+
 #define IS31FL3741_SCALING_0_REGISTER_COUNT 180
 #define IS31FL3741_SCALING_1_REGISTER_COUNT 171
 
@@ -75,18 +84,18 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
-    uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t             pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
+    uint8_t             pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    is31fl37xx_chunks_t pwm_buffer_dirty;
+    uint8_t             scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
+    uint8_t             scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
+    bool                scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -107,38 +116,29 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+static void is31fl3741_write_pwm_chunks(uint8_t index, is31fl37xx_chunks_t chunks) {
+    is31fl37xx_chunks_t chunks_0 = chunks & ((1 << IS31FL3741_PWM_1_CHUNK_SHIFT) - 1);
+    is31fl37xx_chunks_t chunks_1 = chunks >> IS31FL3741_PWM_1_CHUNK_SHIFT;
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    if (chunks_0) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
-#endif
+        // Transmit PWM0 registers in up to 6 transfers of 30 bytes.
+        is31fl37xx_write_chunks(i2c_addresses[index] << 1, 0, driver_buffers[index].pwm_buffer_0, IS31FL3741_PWM_0_REGISTER_COUNT, IS31FL3741_PWM_0_CHUNK_SIZE, chunks_0, IS31FL3741_I2C_PERSISTENCE, IS31FL3741_I2C_TIMEOUT);
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
-
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+    if (chunks_1) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
-#endif
+        // Transmit PWM1 registers in up to 9 transfers of 19 bytes.
+        is31fl37xx_write_chunks(i2c_addresses[index] << 1, 0, driver_buffers[index].pwm_buffer_1, IS31FL3741_PWM_1_REGISTER_COUNT, IS31FL3741_PWM_1_CHUNK_SIZE, chunks_1, IS31FL3741_I2C_PERSISTENCE, IS31FL3741_I2C_TIMEOUT);
     }
 }
 
+void is31fl3741_write_pwm_buffer(uint8_t index) {
+    is31fl3741_write_pwm_chunks(index, IS31FL37XX_ALL_CHUNKS);
+}
+
 void is31fl3741_init_drivers(void) {
     i2c_init();
 
@@ -196,8 +196,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        driver_buffers[driver].pwm_buffer_dirty |= IS31FL37XX_CHUNK(reg & 0xFF, IS31FL3741_PWM_1_CHUNK_SIZE) << IS31FL3741_PWM_1_CHUNK_SHIFT;
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        driver_buffers[driver].pwm_buffer_dirty |= IS31FL37XX_CHUNK(reg, IS31FL3741_PWM_0_CHUNK_SIZE);
     }
 }
 
@@ -212,7 +214,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -241,15 +242,14 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
+        is31fl3741_write_pwm_chunks(index, driver_buffers[index].pwm_buffer_dirty);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -0,0 +1,54 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "i2c_master.h"
+
+/**
+ * Dirty tracking for the PWM buffers of the IS31FL37xx drivers, which are sent
+ * to the device in fixed-size chunks, one I2C transfer each. Every chunk has
+ * a bit in a mask, so that only the chunks holding changed LEDs are sent.
+ */
+
+typedef uint32_t is31fl37xx_chunks_t;
+
+#define IS31FL37XX_ALL_CHUNKS ((is31fl37xx_chunks_t)~0)
+
+/**
+ * @brief The bit for the chunk that holds the given register.
+ */
+#define IS31FL37XX_CHUNK(reg, chunk_size) ((is31fl37xx_chunks_t)1 << ((reg) / (chunk_size)))
+
+/**
+ * @brief The number of chunks a buffer is sent in, which must not exceed IS31FL37XX_MAX_CHUNKS.
+ */
+#define IS31FL37XX_CHUNK_COUNT(length, chunk_size) (((length) + (chunk_size)-1) / (chunk_size))
+
+#define IS31FL37XX_MAX_CHUNKS (sizeof(is31fl37xx_chunks_t) * 8)
+
+/**
+ * @brief Writes the chunks of a buffer that are set in a mask.
+ *
+ * \param address The shifted I2C address of the device.
+ * \param reg The register the buffer starts at.
+ * \param buffer The buffer to write.
+ * \param length The size of the buffer, the last chunk is cut short to fit.
+ * \param chunk_size The number of bytes sent per transfer.
+ * \param chunks The chunks to write, `IS31FL37XX_ALL_CHUNKS` for the whole buffer.
+ * \param persistence The number of attempts for each transfer, 0 for a single one.
+ * \param timeout The I2C timeout of each transfer.
+ */
+static inline void is31fl37xx_write_chunks(uint8_t address, uint8_t reg, const uint8_t *buffer, uint16_t length, uint8_t chunk_size, is31fl37xx_chunks_t chunks, uint8_t persistence, uint16_t timeout) {
+    for (uint16_t offset = 0; chunks && offset < length; offset += chunk_size, chunks >>= 1) {
+        if (!(chunks & 1)) {
+            continue;
+        }
+        uint8_t size = length - offset < chunk_size ? length - offset : chunk_size;
+        uint8_t i    = 0;
+        do {
+            if (i2c_write_register(address, reg + offset, buffer + offset, size, timeout) == I2C_STATUS_SUCCESS) break;
+        } while (++i < persistence);
+    }
+}
@@ -3,12 +3,20 @@
 
 #ifdef QUANTUM_PAINTER_SPI_ENABLE
 
+#    include <string.h>
+
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
 
+#    if QUANTUM_PAINTER_SPI_ASYNC
+// Data is copied into whichever of these is not on the bus, so the caller can reuse its own buffer straight away
+static uint8_t qp_comms_spi_async_buffers[2][QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE] __attribute__((__aligned__(4)));
+static uint8_t qp_comms_spi_async_next = 0;
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
+
 bool qp_comms_spi_init(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -33,11 +41,25 @@ bool qp_comms_spi_start(painter_device_t device) {
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
-    const uint32_t max_msg_length  = 1024;
+#    if QUANTUM_PAINTER_SPI_ASYNC
+    const uint32_t max_msg_length = QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE;
+#    else
+    const uint32_t max_msg_length = 1024;
+#    endif
 
     while (bytes_remaining > 0) {
         uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
+#    if QUANTUM_PAINTER_SPI_ASYNC
+        // The buffer used for the previous chunk may still be on the bus, the other one was waited for when it started
+        uint8_t *buffer = qp_comms_spi_async_buffers[qp_comms_spi_async_next];
+        memcpy(buffer, p, bytes_this_loop);
+        if (spi_transmit_async(buffer, bytes_this_loop) != SPI_STATUS_SUCCESS) {
+            break;
+        }
+        qp_comms_spi_async_next ^= 1;
+#    else
         spi_transmit(p, bytes_this_loop);
+#    endif
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
     }
@@ -45,6 +67,12 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+void qp_comms_spi_fence(painter_device_t device) {
+#    if QUANTUM_PAINTER_SPI_ASYNC
+    spi_transmit_wait();
+#    endif
+}
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +85,7 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+    .comms_fence = qp_comms_spi_fence,
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +129,8 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    // Pixel data may still be on the bus, and has to go out with D/C high
+    qp_comms_spi_fence(device);
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -135,6 +166,7 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+            .comms_fence = qp_comms_spi_fence,
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -21,6 +21,24 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_REGION_COUNT
+/**
+ * @def This controls the maximum number of separate dirty regions each surface keeps track of. Drawing in places far
+ *      apart starts a new region, so that only those areas are transferred to the display, each with its own viewport.
+ *      Once all are in use, further drawing grows whichever region needs the least extra area. Setting this to 1 keeps
+ *      a single bounding box.
+ */
+#    define SURFACE_DIRTY_REGION_COUNT 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_DISTANCE
+/**
+ * @def This controls how close, in pixels, drawing has to be to an existing dirty region to grow it instead of
+ *      starting a new one. Regions that come within this distance of each other are merged.
+ */
+#    define SURFACE_DIRTY_MERGE_DISTANCE 8
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -5,6 +5,9 @@
 #include "qp_draw.h"
 #include "qp_surface_internal.h"
 
+// Region counts and indices are kept in a uint8_t
+_Static_assert(SURFACE_DIRTY_REGION_COUNT >= 1 && SURFACE_DIRTY_REGION_COUNT <= 255, "SURFACE_DIRTY_REGION_COUNT needs to be between 1 and 255");
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver storage
 
@@ -29,24 +32,102 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline bool region_is_near(const surface_dirty_region_t *region, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (int32_t)l <= (int32_t)region->r + SURFACE_DIRTY_MERGE_DISTANCE && (int32_t)region->l <= (int32_t)r + SURFACE_DIRTY_MERGE_DISTANCE && (int32_t)t <= (int32_t)region->b + SURFACE_DIRTY_MERGE_DISTANCE && (int32_t)region->t <= (int32_t)b + SURFACE_DIRTY_MERGE_DISTANCE;
+}
+
+static inline uint32_t region_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+// Extra area a region would cover if it were grown to include the point
+static inline uint32_t region_growth(const surface_dirty_region_t *region, uint16_t x, uint16_t y) {
+    uint16_t l = QP_MIN(region->l, x);
+    uint16_t t = QP_MIN(region->t, y);
+    uint16_t r = QP_MAX(region->r, x);
+    uint16_t b = QP_MAX(region->b, y);
+    return region_area(l, t, r, b) - region_area(region->l, region->t, region->r, region->b);
+}
+
+static inline void region_grow(surface_dirty_region_t *region, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    region->l = QP_MIN(region->l, l);
+    region->t = QP_MIN(region->t, t);
+    region->r = QP_MAX(region->r, r);
+    region->b = QP_MAX(region->b, b);
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
+    // Nothing to do if the pixel is already inside a dirty region
+    for (uint8_t i = 0; i < dirty->region_count; ++i) {
+        surface_dirty_region_t *region = &dirty->regions[i];
+        if (x >= region->l && x <= region->r && y >= region->t && y <= region->b) {
+            return;
+        }
+    }
+
+    // Prefer growing the nearby region that needs the least extra area; if none is nearby start a new region, and if
+    // there's no space left for one, grow whichever region is cheapest regardless of distance
+    uint8_t  best        = dirty->region_count;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->region_count; ++i) {
+        if (region_is_near(&dirty->regions[i], x, y, x, y)) {
+            uint32_t growth = region_growth(&dirty->regions[i], x, y);
+            if (growth < best_growth) {
+                best        = i;
+                best_growth = growth;
+            }
+        }
+    }
+    if (best == dirty->region_count && dirty->region_count == SURFACE_DIRTY_REGION_COUNT) {
+        for (uint8_t i = 0; i < dirty->region_count; ++i) {
+            uint32_t growth = region_growth(&dirty->regions[i], x, y);
+            if (growth < best_growth) {
+                best        = i;
+                best_growth = growth;
+            }
+        }
+    }
+
+    surface_dirty_region_t *region = &dirty->regions[best];
+    if (best == dirty->region_count) {
+        *region = (surface_dirty_region_t){.l = x, .t = y, .r = x, .b = y};
+        dirty->region_count++;
+    } else {
+        region_grow(region, x, y, x, y);
+
+        // Absorb any other region the grown one has come close to, which may in turn grow it further
+        for (uint8_t i = 0; i < dirty->region_count;) {
+            if (i != best && region_is_near(region, dirty->regions[i].l, dirty->regions[i].t, dirty->regions[i].r, dirty->regions[i].b)) {
+                region_grow(region, dirty->regions[i].l, dirty->regions[i].t, dirty->regions[i].r, dirty->regions[i].b);
+
+                // Move the last region into the gap, keeping track of the one being grown
+                dirty->region_count--;
+                dirty->regions[i] = dirty->regions[dirty->region_count];
+                if (best == dirty->region_count) {
+                    best   = i;
+                    region = &dirty->regions[best];
+                }
+                i = 0;
+                continue;
+            }
+            ++i;
+        }
+    }
+
+    // Maintain the overall bounding box
     if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+        dirty->l = x;
     }
     if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+        dirty->r = x;
     }
     if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+        dirty->t = y;
     }
     if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+        dirty->b = y;
     }
+    dirty->is_dirty = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +138,13 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.l            = 0;
+    surface->dirty.t            = 0;
+    surface->dirty.r            = surface->base.panel_width - 1;
+    surface->dirty.b            = surface->base.panel_height - 1;
+    surface->dirty.is_dirty     = true;
+    surface->dirty.region_count = 1;
+    surface->dirty.regions[0]   = (surface_dirty_region_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
 
     return true;
 }
@@ -83,6 +166,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty.region_count         = 0;
     return true;
 }
 
@@ -16,12 +16,23 @@ typedef struct surface_painter_driver_vtable_t {
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
+typedef struct surface_dirty_region_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_region_t;
+
 typedef struct surface_dirty_data_t {
     bool     is_dirty;
-    uint16_t l;
+    uint16_t l; // l/t/r/b are the bounding box of all the regions
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Separate areas that have been drawn to, transferred individually to the target
+    uint8_t                region_count;
+    surface_dirty_region_t regions[SURFACE_DIRTY_REGION_COUNT];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
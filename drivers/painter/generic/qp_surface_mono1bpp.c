@@ -84,8 +84,75 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
+static bool mono1bpp_target_region_transfer(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    // Set the target drawing area
+    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    if (!ok) {
+        qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = 8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE;
+    uint32_t pixel_counter     = 0;
+    uint8_t *target_buffer     = qp_internal_global_pixdata_buffer;
+
+    // Pack the pixels into the global pixdata area, in the same bit order as the surface itself uses
+    for (uint16_t y = t; y <= b; ++y) {
+        for (uint16_t x = l; x <= r; ++x) {
+            uint32_t pixel_num  = y * surface_handle->base.panel_width + x;
+            bool     mono_pixel = (surface_handle->u8buffer[pixel_num / 8] & (1 << (pixel_num % 8))) ? true : false;
+
+            // Update the target buffer
+            if (pixel_counter % 8 == 0) {
+                target_buffer[pixel_counter / 8] = 0;
+            }
+            if (mono_pixel) {
+                target_buffer[pixel_counter / 8] |= (1 << (pixel_counter % 8));
+            }
+            pixel_counter++;
+
+            // If we've accumulated enough data, send it
+            if (pixel_counter == total_pixel_count) {
+                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                if (!ok) {
+                    qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    return false;
+                }
+                // Reset the counter
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (pixel_counter > 0) {
+        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+        if (!ok) {
+            qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return mono1bpp_target_region_transfer(surface_handle, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Each dirty region gets its own viewport, so untouched areas in between are skipped
+    for (uint8_t i = 0; i < surface_handle->dirty.region_count; ++i) {
+        surface_dirty_region_t *region = &surface_handle->dirty.regions[i];
+        if (!mono1bpp_target_region_transfer(surface_handle, target_driver, x, y, region->l, region->t, region->r, region->b)) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -118,6 +118,7 @@ static uint32_t qp_ili9486_send_data_toggling(painter_device_t device, const uin
     for (uint8_t j = 0; j < byte_count; ++j) {
         writePinLow(comms_config->spi_config.chip_select_pin);
         ret = qp_comms_spi_dc_reset_send_data(device, &data[j], 1);
+        qp_comms_spi_fence(device);
         writePinHigh(comms_config->spi_config.chip_select_pin);
     }
 
@@ -307,6 +307,7 @@ const ld7032_comms_with_command_vtable_t ld7032_spi_comms_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+            .comms_fence = qp_comms_spi_fence,
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .send_command_data     = qp_comms_command_databyte,
@@ -93,6 +93,28 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, returning before the transfer completes.
+ *
+ * Any transfer already in progress is waited for first. The data is read directly from `data` while the transfer
+ * runs, so it must not be modified until `spi_transmit_wait()` returns. All other SPI functions, including
+ * `spi_stop()`, wait for the transfer to complete before doing anything else. Platforms without a background
+ * transfer mechanism send the data before returning.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Wait for a transfer started with `spi_transmit_async()` to complete.
+ *
+ * \return `SPI_STATUS_SUCCESS` once no transfer is in progress.
+ */
+spi_status_t spi_transmit_wait(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -8,11 +8,20 @@
 #    include "flash_spi.h"
 #endif
 
-// Use 1 block -- check the config for the SPI flash to determine how big it is
+// Use 1 block, or 2 with double buffering -- check the config for the SPI flash to determine how big it is
 #ifndef WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT
-#    define WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT 1
+#    ifdef WEAR_LEVELING_DOUBLE_BUFFER
+#        define WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT 2
+#    else
+#        define WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT 1
+#    endif
 #endif // WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT
 
+// Erase a block of the retired bank at a time with double buffering
+#if defined(WEAR_LEVELING_DOUBLE_BUFFER) && !defined(WEAR_LEVELING_ERASE_SLICE_SIZE)
+#    define WEAR_LEVELING_ERASE_SLICE_SIZE (EXTERNAL_FLASH_BLOCK_SIZE)
+#endif // WEAR_LEVELING_ERASE_SLICE_SIZE
+
 // Start at the first block of the external flash
 #ifndef WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET
 #    define WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET 0
@@ -28,7 +37,11 @@
 #    define WEAR_LEVELING_BACKING_SIZE ((EXTERNAL_FLASH_BLOCK_SIZE) * (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT))
 #endif // WEAR_LEVELING_BACKING_SIZE
 
-// Use half of the backing size for logical EEPROM
+// Use half of the backing size for logical EEPROM -- with double buffering this has to be chosen explicitly
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
-#    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifdef WEAR_LEVELING_DOUBLE_BUFFER
+#        error WEAR_LEVELING_LOGICAL_SIZE needs to be set with WEAR_LEVELING_DOUBLE_BUFFER, to at most a quarter of WEAR_LEVELING_BACKING_SIZE
+#    else
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    endif
 #endif // WEAR_LEVELING_LOGICAL_SIZE
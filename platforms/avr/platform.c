@@ -16,6 +16,11 @@
 
 #include "platform_deps.h"
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include <avr/sleep.h>
+#    include "idle_scheduler.h"
+#endif
+
 static void disable_jtag(void) {
 // To use PF4-7 (PC2-5 on ATmega32A), disable JTAG by writing JTD bit twice within four cycles.
 #if (defined(__AVR_AT90USB646__) || defined(__AVR_AT90USB647__) || defined(__AVR_AT90USB1286__) || defined(__AVR_AT90USB1287__) || defined(__AVR_ATmega16U4__) || defined(__AVR_ATmega32U4__))
@@ -30,3 +35,13 @@ static void disable_jtag(void) {
 void platform_setup(void) {
     disable_jtag();
 }
+
+#ifdef IDLE_SCHEDULER_ENABLE
+void platform_idle_wait(uint32_t timeout_ms) {
+    // Any interrupt ends the sleep, including the millisecond timer tick
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_mode();
+}
+
+void platform_idle_wake(void) {}
+#endif
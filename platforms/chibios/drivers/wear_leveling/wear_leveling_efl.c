@@ -100,6 +100,28 @@ bool backing_store_init(void) {
 
 #endif // defined(WEAR_LEVELING_EFL_FIRST_SECTOR)
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    // Each bank is erased on its own, so both of them need to be a whole number of sectors
+    uint32_t bank_size = 0;
+    if (counter == (WEAR_LEVELING_BACKING_SIZE)) {
+        for (flash_sector_t i = 0; i < sector_count && bank_size < (WEAR_LEVELING_BANK_SIZE); ++i) {
+            bank_size += flashGetSectorSize(flash, first_sector + i);
+        }
+    }
+    if (bank_size != (WEAR_LEVELING_BANK_SIZE)) {
+        // Erasing one bank would take out part of the other. Can't do anything here. Fault.
+        chSysHalt("Double buffered wear_leveling banks do not line up with sector boundaries");
+    }
+
+    // The retired bank is erased a slice at a time, so no sector may straddle two slices either
+    for (flash_sector_t i = 0; i < sector_count; ++i) {
+        uint32_t offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        if ((offset % (WEAR_LEVELING_ERASE_SLICE_SIZE)) + flashGetSectorSize(flash, first_sector + i) > (WEAR_LEVELING_ERASE_SLICE_SIZE)) {
+            chSysHalt("Double buffered wear_leveling erase slices do not line up with sector boundaries");
+        }
+    }
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
     return true;
 }
 
@@ -133,6 +155,43 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#endif
+
+    // Erase the sectors within the range -- one only partly covered by it can't be erased without losing data outside it
+    bool          ret = true;
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        uint32_t offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        uint32_t size   = flashGetSectorSize(flash, first_sector + i);
+        if (offset + size <= address || offset >= address + length) {
+            continue;
+        }
+        if (offset < address || offset + size > address + length) {
+            bs_dprintf("Range erase does not line up with sector %d\n", (int)(first_sector + i));
+            ret = false;
+            continue;
+        }
+
+        // Kick off the sector erase
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        // Wait for the erase to complete
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
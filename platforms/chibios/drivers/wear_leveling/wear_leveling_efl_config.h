@@ -50,7 +50,29 @@
 #    define WEAR_LEVELING_BACKING_SIZE 2048
 #endif // WEAR_LEVELING_BACKING_SIZE
 
-// 1kB logical EEPROM
+// 1kB logical EEPROM -- with double buffering this has to be chosen explicitly
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
-#    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifdef WEAR_LEVELING_DOUBLE_BUFFER
+#        error WEAR_LEVELING_LOGICAL_SIZE needs to be set with WEAR_LEVELING_DOUBLE_BUFFER, to at most a quarter of WEAR_LEVELING_BACKING_SIZE
+#    else
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    endif
 #endif // WEAR_LEVELING_LOGICAL_SIZE
+
+// Erase a sector of the retired bank at a time with double buffering. This has to be a whole number of the sectors
+// used, so where a family comes with more than one page size, the largest is picked.
+#if defined(WEAR_LEVELING_DOUBLE_BUFFER) && !defined(WEAR_LEVELING_ERASE_SLICE_SIZE)
+#    if defined(STM32_FLASH_SECTOR_SIZE) // from some family's hal_efl_lld.h file
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE (STM32_FLASH_SECTOR_SIZE)
+#    elif defined(QMK_MCU_SERIES_GD32VF103)
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE 1024
+#    elif defined(QMK_MCU_FAMILY_AT32)
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE 2048
+#    elif defined(QMK_MCU_SERIES_STM32F0XX) || defined(QMK_MCU_SERIES_STM32F1XX) || defined(QMK_MCU_SERIES_STM32F3XX) || defined(QMK_MCU_SERIES_STM32L4XX) || defined(QMK_MCU_SERIES_STM32G0XX)
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE 2048
+#    elif defined(QMK_MCU_SERIES_STM32G4XX)
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE 4096
+#    else
+#        error WEAR_LEVELING_ERASE_SLICE_SIZE needs to be set with WEAR_LEVELING_DOUBLE_BUFFER, to the size of the largest flash sector used
+#    endif
+#endif // WEAR_LEVELING_ERASE_SLICE_SIZE
@@ -7,6 +7,12 @@
 #include "wear_leveling_internal.h"
 #include "legacy_flash_ops.h"
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+// Pages are the smallest unit that can be erased, so banks and erase slices need to be made of whole pages
+_Static_assert((WEAR_LEVELING_BANK_SIZE) % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) == 0, "WEAR_LEVELING_BANK_SIZE needs to be a multiple of WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE");
+_Static_assert((WEAR_LEVELING_ERASE_SLICE_SIZE) % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) == 0, "WEAR_LEVELING_ERASE_SLICE_SIZE needs to be a multiple of WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE");
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
 bool backing_store_init(void) {
     bs_dprintf("Init\n");
     return true;
@@ -36,6 +42,32 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+#ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#endif
+
+    // Erase the pages within the range -- one only partly covered by it can't be erased without losing data outside it
+    bool         ret = true;
+    FLASH_Status status;
+    uint32_t     first_page = address - (address % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE));
+    for (uint32_t offset = first_page; offset < address + length; offset += (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) {
+        if (offset < address || offset + (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) > address + length) {
+            bs_dprintf("Range erase does not line up with the page at offset %lu\n", (unsigned long)offset);
+            ret = false;
+            continue;
+        }
+
+        status = FLASH_ErasePage(WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS + offset);
+        if (status != FLASH_COMPLETE) {
+            ret = false;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = ((WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS) + address);
     bs_dprintf("Write ");
@@ -65,3 +65,8 @@
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
 #    define WEAR_LEVELING_LOGICAL_SIZE 1024
 #endif
+
+// Erase a page of the retired bank at a time with double buffering
+#if defined(WEAR_LEVELING_DOUBLE_BUFFER) && !defined(WEAR_LEVELING_ERASE_SLICE_SIZE)
+#    define WEAR_LEVELING_ERASE_SLICE_SIZE (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)
+#endif // WEAR_LEVELING_ERASE_SLICE_SIZE
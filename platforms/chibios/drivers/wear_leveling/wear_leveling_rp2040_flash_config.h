@@ -16,11 +16,20 @@
 #    define WEAR_LEVELING_BACKING_SIZE 8192
 #endif // WEAR_LEVELING_BACKING_SIZE
 
-// 32kB logical EEPROM
+// 32kB logical EEPROM -- with double buffering this has to be chosen explicitly
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
-#    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    ifdef WEAR_LEVELING_DOUBLE_BUFFER
+#        error WEAR_LEVELING_LOGICAL_SIZE needs to be set with WEAR_LEVELING_DOUBLE_BUFFER, to at most a quarter of WEAR_LEVELING_BACKING_SIZE
+#    else
+#        define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    endif
 #endif // WEAR_LEVELING_LOGICAL_SIZE
 
+// Erase a sector of the retired bank at a time with double buffering
+#if defined(WEAR_LEVELING_DOUBLE_BUFFER) && !defined(WEAR_LEVELING_ERASE_SLICE_SIZE)
+#    define WEAR_LEVELING_ERASE_SLICE_SIZE (FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_ERASE_SLICE_SIZE
+
 // Define how much flash space we have (defaults to lib/pico-sdk/src/boards/include/boards/***)
 #ifndef WEAR_LEVELING_RP2040_FLASH_SIZE
 #    define WEAR_LEVELING_RP2040_FLASH_SIZE (PICO_FLASH_SIZE_BYTES)
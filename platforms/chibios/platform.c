@@ -16,7 +16,45 @@
 
 #include "platform_deps.h"
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+
+static thread_reference_t idle_thread       = NULL;
+static bool               idle_wake_pending = false;
+#endif
+
 void platform_setup(void) {
     halInit();
     chSysInit();
-}
\ No newline at end of file
+}
+
+#ifdef IDLE_SCHEDULER_ENABLE
+void platform_idle_wait(uint32_t timeout_ms) {
+    // Suspending the main thread lets the idle thread put the core to sleep
+    chSysLock();
+    if (!idle_wake_pending) {
+        chThdSuspendTimeoutS(&idle_thread, TIME_MS2I(timeout_ms));
+    }
+    idle_wake_pending = false;
+    chSysUnlock();
+}
+
+void platform_idle_wake(void) {
+    chSysLockFromISR();
+    idle_wake_pending = true;
+    chThdResumeI(&idle_thread, MSG_OK);
+    chSysUnlockFromISR();
+}
+
+#    if PAL_USE_CALLBACKS == TRUE
+static void idle_scheduler_pin_callback(void *arg) {
+    (void)arg;
+    idle_scheduler_wake();
+}
+
+void idle_scheduler_wake_on_pin(pin_t pin) {
+    palSetLineCallback(pin, idle_scheduler_pin_callback, NULL);
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+}
+#    endif
+#endif
@@ -0,0 +1,86 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Host-side I2C and SPI masters, which record every transaction instead of
+ * talking to a device. Each transaction is costed at the configured bus clock,
+ * so that the bus time spent by a driver can be measured and held steady by
+ * tests. Reads from a device return zeros.
+ */
+
+#ifndef BUS_RECORDER_LOG_SIZE
+#    define BUS_RECORDER_LOG_SIZE 1024
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct bus_record_t {
+    uint16_t device;  // I2C address as passed to the driver, or the SPI slave select pin
+    bool     read;    // the device sent data back
+    uint32_t length;  // bytes on the wire, including I2C register addresses but not the device address
+    uint32_t time_ns; // bus time at the configured clock
+} bus_record_t;
+
+typedef struct bus_stats_t {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint64_t time_ns;
+    uint32_t unlogged; // transactions counted after the log filled up
+
+    // SPI only, on a virtual clock that advances with blocking transfers, waits for background transfers, and
+    // spi_recorder_advance(); background transfers run alongside it
+    uint64_t elapsed_ns; // virtual time since the statistics were cleared
+    uint64_t overlap_ns; // bus time of background transfers that was not spent waiting for them
+} bus_stats_t;
+
+/**
+ * @brief Sets the I2C clock, 400kHz by default.
+ */
+void i2c_recorder_set_clock(uint32_t hz);
+
+/**
+ * @brief Makes every I2C transaction to the given address fail, as if the
+ * device did not acknowledge.
+ */
+void i2c_recorder_set_absent(uint8_t address, bool absent);
+
+/**
+ * @brief Clears the I2C statistics and log, keeping the configuration.
+ */
+void i2c_recorder_clear(void);
+
+bus_stats_t         i2c_recorder_get_stats(void);
+const bus_record_t *i2c_recorder_get_log(size_t *count);
+
+/**
+ * @brief Sets the clock the SPI divisors apply to, 48MHz by default.
+ */
+void spi_recorder_set_clock(uint32_t hz);
+
+/**
+ * @brief Clears the SPI statistics and log, keeping the configuration. An
+ * SPI transaction runs from `spi_start()` to `spi_stop()`.
+ */
+void spi_recorder_clear(void);
+
+/**
+ * @brief Advances the SPI virtual clock, to account for work done by the
+ * caller, such as decoding the next chunk while a background transfer from
+ * `spi_transmit_async()` is on the bus.
+ */
+void spi_recorder_advance(uint32_t ns);
+
+bus_stats_t         spi_recorder_get_stats(void);
+const bus_record_t *spi_recorder_get_log(size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "i2c_master.h"
+#include "bus_recorder.h"
+
+static uint32_t     i2c_clock_hz = 400000;
+static uint8_t      i2c_absent[256 / 8];
+static bus_stats_t  i2c_recorder_stats;
+static bus_record_t i2c_recorder_log[BUS_RECORDER_LOG_SIZE];
+
+void i2c_recorder_set_clock(uint32_t hz) {
+    i2c_clock_hz = hz;
+}
+
+void i2c_recorder_set_absent(uint8_t address, bool absent) {
+    if (absent) {
+        i2c_absent[address / 8] |= 1 << (address % 8);
+    } else {
+        i2c_absent[address / 8] &= ~(1 << (address % 8));
+    }
+}
+
+void i2c_recorder_clear(void) {
+    memset(&i2c_recorder_stats, 0, sizeof(i2c_recorder_stats));
+}
+
+bus_stats_t i2c_recorder_get_stats(void) {
+    return i2c_recorder_stats;
+}
+
+const bus_record_t *i2c_recorder_get_log(size_t *count) {
+    *count = i2c_recorder_stats.transactions - i2c_recorder_stats.unlogged;
+    return i2c_recorder_log;
+}
+
+/**
+ * @brief Records a transaction and its bus time: every byte, including the
+ * device address sent once per start condition, takes nine clocks with its
+ * acknowledge bit, and each start and stop condition takes one more.
+ *
+ * @return I2C_STATUS_ERROR if the device is absent, and only its address went
+ * out on the bus.
+ */
+static i2c_status_t i2c_record(uint8_t address, bool read, uint16_t register_length, uint16_t data_length) {
+    bool     absent = i2c_absent[address / 8] & (1 << (address % 8));
+    uint16_t length = absent ? 0 : register_length + data_length;
+    uint32_t starts = read && register_length && !absent ? 2 : 1;
+    uint32_t clocks = (starts + length) * 9 + starts + 1;
+
+    bus_record_t record = {
+        .device  = address,
+        .read    = read && !absent,
+        .length  = length,
+        .time_ns = (uint64_t)clocks * 1000000000 / i2c_clock_hz,
+    };
+    if (i2c_recorder_stats.transactions - i2c_recorder_stats.unlogged < BUS_RECORDER_LOG_SIZE) {
+        i2c_recorder_log[i2c_recorder_stats.transactions - i2c_recorder_stats.unlogged] = record;
+    } else {
+        i2c_recorder_stats.unlogged++;
+    }
+    i2c_recorder_stats.transactions++;
+    i2c_recorder_stats.bytes += length;
+    i2c_recorder_stats.time_ns += record.time_ns;
+
+    return absent ? I2C_STATUS_ERROR : I2C_STATUS_SUCCESS;
+}
+
+#ifdef I2C_STATS_ENABLE
+i2c_stats_t i2c_get_stats(void) {
+    return (i2c_stats_t){.transfers = i2c_recorder_stats.transactions, .bytes = i2c_recorder_stats.bytes};
+}
+
+void i2c_clear_stats(void) {
+    i2c_recorder_clear();
+}
+#endif // I2C_STATS_ENABLE
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return i2c_record(address, false, 0, length);
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return i2c_record(address, true, 0, length);
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return i2c_record(devaddr, false, 1, length);
+}
+
+i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    return i2c_record(devaddr, false, 2, length);
+}
+
+i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return i2c_record(devaddr, true, 1, length);
+}
+
+i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout) {
+    memset(data, 0, length);
+    return i2c_record(devaddr, true, 2, length);
+}
+
+i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
+    return i2c_record(address, false, 0, 0);
+}
@@ -0,0 +1,188 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial.h"
+#include "serial_loopback.h"
+#include "transactions.h"
+#include "transport.h"
+
+void advance_time(uint32_t ms);
+
+static serial_loopback_config_t loopback_config = SERIAL_LOOPBACK_DEFAULT_CONFIG;
+static serial_loopback_stats_t  loopback_stats;
+static split_shared_memory_t    slave_shmem;
+static bool                     in_slave        = false;
+static uint32_t                 random_state    = 1;
+static uint32_t                 pending_time_us = 0; // bus time not yet added to the timer
+
+#define slave_shmem_offset_ptr(offset) (((uint8_t *)&slave_shmem) + (offset))
+
+static uint32_t next_random(void) {
+    // xorshift32, so that runs are reproducible
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static bool one_in_a_million(uint32_t ppm) {
+    return ppm && next_random() % 1000000 < ppm;
+}
+
+static void bus_wait(uint32_t us) {
+    loopback_stats.bus_time_us += us;
+    pending_time_us += us;
+    if (pending_time_us >= 1000) {
+        advance_time(pending_time_us / 1000);
+        pending_time_us %= 1000;
+    }
+}
+
+/**
+ * @brief Moves size bytes across the wire, flipping bits at the configured
+ * error rate.
+ *
+ * @return false if the transfer was lost and the receiver timed out.
+ */
+static bool wire_transfer(uint8_t *destination, const uint8_t *source, size_t size) {
+    bus_wait(loopback_config.turnaround_us);
+    if (one_in_a_million(loopback_config.drop_ppm)) {
+        loopback_stats.drops++;
+        bus_wait(loopback_config.timeout_us);
+        return false;
+    }
+
+    bus_wait((uint64_t)size * 10 * 1000000 / loopback_config.baudrate);
+    loopback_stats.bytes += size;
+    for (size_t i = 0; i < size; i++) {
+        uint8_t byte = source[i];
+        if (loopback_config.bit_error_ppm) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (one_in_a_million(loopback_config.bit_error_ppm)) {
+                    byte ^= 1 << bit;
+                    loopback_stats.bit_errors++;
+                }
+            }
+        }
+        destination[i] = byte;
+    }
+    return true;
+}
+
+static void swap_shared_memory(void) {
+    uint8_t *master = (uint8_t *)split_shmem;
+    uint8_t *slave  = (uint8_t *)&slave_shmem;
+    for (size_t i = 0; i < sizeof(split_shared_memory_t); i++) {
+        uint8_t byte = master[i];
+        master[i]    = slave[i];
+        slave[i]     = byte;
+    }
+}
+
+void serial_loopback_init(const serial_loopback_config_t *config) {
+    if (in_slave) {
+        serial_loopback_exit_slave();
+    }
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&slave_shmem, 0, sizeof(slave_shmem));
+    random_state    = 1;
+    pending_time_us = 0;
+    serial_loopback_clear_stats();
+    serial_loopback_configure(config);
+}
+
+void serial_loopback_configure(const serial_loopback_config_t *config) {
+    loopback_config = *config;
+}
+
+serial_loopback_stats_t serial_loopback_get_stats(void) {
+    return loopback_stats;
+}
+
+void serial_loopback_clear_stats(void) {
+    memset(&loopback_stats, 0, sizeof(loopback_stats));
+}
+
+void serial_loopback_enter_slave(void) {
+    if (!in_slave) {
+        swap_shared_memory();
+        in_slave = true;
+    }
+}
+
+void serial_loopback_exit_slave(void) {
+    if (in_slave) {
+        swap_shared_memory();
+        in_slave = false;
+    }
+}
+
+bool serial_loopback_is_slave(void) {
+    return in_slave;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+/**
+ * @brief Runs a transaction the way the ChibiOS serial protocol does, with
+ * the slave's side handled inline.
+ */
+static bool loopback_transaction(uint8_t transaction_id) {
+    if (transaction_id >= NUM_TOTAL_TRANSACTIONS || in_slave) {
+        return false;
+    }
+    if (loopback_config.disconnected) {
+        bus_wait(loopback_config.timeout_us);
+        return false;
+    }
+
+    split_transaction_desc_t *transaction = &split_transaction_table[transaction_id];
+
+    /* Handshake, which the slave ignores if the ID arrives out of range. */
+    uint8_t received_id = 0;
+    if (!wire_transfer(&received_id, &transaction_id, sizeof(transaction_id))) {
+        return false;
+    }
+    if (received_id >= NUM_TOTAL_TRANSACTIONS) {
+        bus_wait(loopback_config.timeout_us);
+        return false;
+    }
+    uint8_t shake          = received_id ^ NUM_TOTAL_TRANSACTIONS;
+    uint8_t received_shake = 0xFF;
+    if (!wire_transfer(&received_shake, &shake, sizeof(shake)) || received_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    if (transaction->initiator2target_buffer_size) {
+        if (!wire_transfer(slave_shmem_offset_ptr(transaction->initiator2target_offset), split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size)) {
+            return false;
+        }
+    }
+
+    if (transaction->slave_callback) {
+        serial_loopback_enter_slave();
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->target2initiator_buffer_size, split_trans_target2initiator_buffer(transaction));
+        serial_loopback_exit_slave();
+    }
+
+    if (transaction->target2initiator_buffer_size) {
+        if (!wire_transfer(split_trans_target2initiator_buffer(transaction), slave_shmem_offset_ptr(transaction->target2initiator_offset), transaction->target2initiator_buffer_size)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool soft_serial_transaction(int index) {
+    loopback_stats.transactions++;
+    if (!loopback_transaction((uint8_t)index)) {
+        loopback_stats.failed++;
+        return false;
+    }
+    return true;
+}
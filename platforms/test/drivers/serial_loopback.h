@@ -0,0 +1,58 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Host-side split transport, running both halves in the same process. The
+ * slave half answers each transaction inline against its own copy of the
+ * split shared memory, with the transfers going over a simulated wire.
+ */
+
+typedef struct serial_loopback_config_t {
+    uint32_t baudrate;      // bits per second, each byte takes 10 bits on the wire
+    uint32_t turnaround_us; // added every time the line changes direction
+    uint32_t timeout_us;    // time lost by the master waiting for a transfer that never arrives
+    uint32_t bit_error_ppm; // chance of each bit being flipped, in parts per million
+    uint32_t drop_ppm;      // chance of each transfer being lost, in parts per million
+    bool     disconnected;  // the slave never answers
+} serial_loopback_config_t;
+
+typedef struct serial_loopback_stats_t {
+    uint32_t transactions;
+    uint32_t failed;
+    uint32_t bytes;      // bytes on the wire, in both directions
+    uint32_t bit_errors; // bits flipped by the wire
+    uint32_t drops;      // transfers lost by the wire
+    uint64_t bus_time_us;
+} serial_loopback_stats_t;
+
+#define SERIAL_LOOPBACK_DEFAULT_CONFIG \
+    { .baudrate = 460800, .turnaround_us = 20, .timeout_us = 20000, .bit_error_ppm = 0, .drop_ppm = 0, .disconnected = false }
+
+/**
+ * @brief Resets the slave's shared memory, the statistics and the random
+ * number generator, and applies the given wire configuration.
+ */
+void serial_loopback_init(const serial_loopback_config_t *config);
+
+void serial_loopback_configure(const serial_loopback_config_t *config);
+
+serial_loopback_stats_t serial_loopback_get_stats(void);
+void                    serial_loopback_clear_stats(void);
+
+/**
+ * @brief Swaps the slave's shared memory in, so that the slave half's tasks,
+ * such as `transport_slave()`, can run between this and
+ * `serial_loopback_exit_slave()`.
+ */
+void serial_loopback_enter_slave(void);
+void serial_loopback_exit_slave(void);
+
+/**
+ * @brief Whether the code currently running is the slave half.
+ */
+bool serial_loopback_is_slave(void);
@@ -0,0 +1,146 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "spi_master.h"
+#include "bus_recorder.h"
+
+static uint32_t     spi_clock_hz = 48000000;
+static bool         spi_started  = false;
+static bus_record_t spi_current;
+static uint16_t     spi_divisor;
+static bus_stats_t  spi_recorder_stats;
+static bus_record_t spi_recorder_log[BUS_RECORDER_LOG_SIZE];
+
+// Virtual clock, and the time the transfer started by spi_transmit_async() leaves the bus
+static uint64_t spi_now_ns;
+static uint64_t spi_async_end_ns;
+static uint64_t spi_async_ns;
+static uint64_t spi_waited_ns;
+
+void spi_recorder_set_clock(uint32_t hz) {
+    spi_clock_hz = hz;
+}
+
+void spi_recorder_clear(void) {
+    memset(&spi_recorder_stats, 0, sizeof(spi_recorder_stats));
+    spi_now_ns = spi_async_end_ns = spi_async_ns = spi_waited_ns = 0;
+}
+
+void spi_recorder_advance(uint32_t ns) {
+    spi_now_ns += ns;
+}
+
+bus_stats_t spi_recorder_get_stats(void) {
+    bus_stats_t stats = spi_recorder_stats;
+    stats.elapsed_ns  = spi_now_ns;
+    stats.overlap_ns  = spi_async_ns - spi_waited_ns;
+    return stats;
+}
+
+const bus_record_t *spi_recorder_get_log(size_t *count) {
+    *count = spi_recorder_stats.transactions - spi_recorder_stats.unlogged;
+    return spi_recorder_log;
+}
+
+/**
+ * @brief Adds bytes to the current transaction, at eight clocks each, and
+ * returns how long they take on the bus.
+ */
+static uint64_t spi_record(bool read, uint16_t length) {
+    uint64_t time_ns = (uint64_t)length * 8 * spi_divisor * 1000000000 / spi_clock_hz;
+    spi_current.read |= read;
+    spi_current.length += length;
+    spi_current.time_ns += time_ns;
+    return time_ns;
+}
+
+/**
+ * @brief Records a transfer that holds up the caller until it is done.
+ */
+static spi_status_t spi_record_blocking(bool read, uint16_t length) {
+    spi_transmit_wait();
+    if (!spi_started) {
+        return SPI_STATUS_ERROR;
+    }
+    spi_now_ns += spi_record(read, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_init(void) {}
+
+bool spi_start_extended(spi_start_config_t *start_config) {
+    if (spi_started || start_config->mode > 3) {
+        return false;
+    }
+    spi_started = true;
+    spi_divisor = start_config->divisor ? start_config->divisor : 1;
+    spi_current = (bus_record_t){.device = start_config->slave_pin};
+    return true;
+}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    spi_start_config_t start_config = {
+        .slave_pin     = slavePin,
+        .lsb_first     = lsbFirst,
+        .mode          = mode,
+        .divisor       = divisor,
+        .cs_active_low = true,
+    };
+    return spi_start_extended(&start_config);
+}
+
+spi_status_t spi_write(uint8_t data) {
+    return spi_record_blocking(false, 1);
+}
+
+spi_status_t spi_read(void) {
+    spi_status_t status = spi_record_blocking(true, 1);
+    return status == SPI_STATUS_SUCCESS ? 0 : status;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    return spi_record_blocking(false, length);
+}
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+    if (!spi_started) {
+        return SPI_STATUS_ERROR;
+    }
+    uint64_t time_ns = spi_record(false, length);
+    spi_async_end_ns = spi_now_ns + time_ns;
+    spi_async_ns += time_ns;
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_wait(void) {
+    if (spi_async_end_ns > spi_now_ns) {
+        spi_waited_ns += spi_async_end_ns - spi_now_ns;
+        spi_now_ns = spi_async_end_ns;
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    memset(data, 0, length);
+    return spi_record_blocking(true, length);
+}
+
+void spi_stop(void) {
+    spi_transmit_wait();
+    if (!spi_started) {
+        return;
+    }
+    spi_started = false;
+
+    if (spi_recorder_stats.transactions - spi_recorder_stats.unlogged < BUS_RECORDER_LOG_SIZE) {
+        spi_recorder_log[spi_recorder_stats.transactions - spi_recorder_stats.unlogged] = spi_current;
+    } else {
+        spi_recorder_stats.unlogged++;
+    }
+    spi_recorder_stats.transactions++;
+    spi_recorder_stats.bytes += spi_current.length;
+    spi_recorder_stats.time_ns += spi_current.time_ns;
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+typedef uint8_t pin_t;
+
+/* The host has no pins, so these only evaluate their arguments. */
+#ifndef gpio_set_pin_input
+#    define gpio_set_pin_input(pin) ((void)(pin))
+#endif
+#ifndef gpio_set_pin_input_high
+#    define gpio_set_pin_input_high(pin) ((void)(pin))
+#endif
+#ifndef gpio_set_pin_input_low
+#    define gpio_set_pin_input_low(pin) ((void)(pin))
+#endif
+#ifndef gpio_set_pin_output_push_pull
+#    define gpio_set_pin_output_push_pull(pin) ((void)(pin))
+#endif
+#ifndef gpio_set_pin_output_open_drain
+#    define gpio_set_pin_output_open_drain(pin) ((void)(pin))
+#endif
+#ifndef gpio_set_pin_output
+#    define gpio_set_pin_output(pin) gpio_set_pin_output_push_pull(pin)
+#endif
+
+#ifndef gpio_write_pin_high
+#    define gpio_write_pin_high(pin) ((void)(pin))
+#endif
+#ifndef gpio_write_pin_low
+#    define gpio_write_pin_low(pin) ((void)(pin))
+#endif
+#ifndef gpio_write_pin
+#    define gpio_write_pin(pin, level) ((void)(pin), (void)(level))
+#endif
+
+#ifndef gpio_read_pin
+#    define gpio_read_pin(pin) ((void)(pin), 0)
+#endif
+
+#ifndef gpio_toggle_pin
+#    define gpio_toggle_pin(pin) ((void)(pin))
+#endif
@@ -16,6 +16,17 @@
 
 #include "platform_deps.h"
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
 void platform_setup(void) {
     // do nothing
-}
\ No newline at end of file
+}
+
+#ifdef IDLE_SCHEDULER_ENABLE
+// The test fixture drives the simulated clock, and only runs the passes the scheduler asks for
+void platform_idle_wait(uint32_t timeout_ms) {}
+
+void platform_idle_wake(void) {}
+#endif
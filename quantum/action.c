@@ -40,6 +40,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "pointing_device.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #if defined(ENCODER_ENABLE) && defined(ENCODER_MAP_ENABLE) && defined(SWAP_HANDS_ENABLE)
 #    include "encoder.h"
 #endif
@@ -76,6 +80,10 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
  * FIXME: Needs documentation.
  */
 void action_exec(keyevent_t event) {
+#ifdef LATENCY_TRACE_ENABLE
+    uint32_t latency_trace_previous = latency_trace_exec_begin(&event);
+#endif
+
     if (IS_EVENT(event)) {
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
@@ -120,6 +128,9 @@ void action_exec(keyevent_t event) {
             clear_oneshot_swaphands();
         }
 #        endif
+#        ifdef IDLE_SCHEDULER_ENABLE
+        oneshot_request_wake();
+#        endif
 #    endif
     }
 #endif
@@ -143,6 +154,10 @@ void action_exec(keyevent_t event) {
         dprintln();
     }
 #endif
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_exec_end(latency_trace_previous);
+#endif
 }
 
 #ifdef SWAP_HANDS_ENABLE
@@ -282,17 +297,24 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
+#ifdef LATENCY_TRACE_ENABLE
+    uint32_t latency_trace_previous = latency_trace_process_begin(record);
+#endif
+
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
 #endif
-        return;
+    } else {
+        process_record_handler(record);
+        post_process_record_quantum(record);
     }
 
-    process_record_handler(record);
-    post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process_end(latency_trace_previous);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
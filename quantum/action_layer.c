@@ -316,6 +316,46 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_TRANSPARENCY_MASK)
+/** \brief opaque layers mask
+ *
+ * Per matrix position, the set of layers on which the key is not transparent
+ */
+static layer_state_t opaque_layers[MATRIX_ROWS][MATRIX_COLS];
+static bool          opaque_layers_valid = false;
+
+/** \brief Layer transparency mask update
+ *
+ * Re-reads a single key of the keymap, e.g. after the dynamic keymap changed
+ */
+void layer_transparency_mask_update(uint8_t layer, keypos_t key) {
+    if (!opaque_layers_valid || layer >= MAX_LAYER || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    if (action_for_key(layer, key).code != ACTION_TRANSPARENT) {
+        opaque_layers[key.row][key.col] |= (layer_state_t)1 << layer;
+    } else {
+        opaque_layers[key.row][key.col] &= ~((layer_state_t)1 << layer);
+    }
+}
+
+/** \brief Layer transparency mask rebuild
+ *
+ * Re-reads the whole keymap
+ */
+void layer_transparency_mask_rebuild(void) {
+    opaque_layers_valid = true;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            opaque_layers[row][col] = 0;
+            for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+                layer_transparency_mask_update(layer, (keypos_t){.row = row, .col = col});
+            }
+        }
+    }
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -326,6 +366,16 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_TRANSPARENCY_MASK
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        if (!opaque_layers_valid) {
+            layer_transparency_mask_rebuild();
+        }
+        layers &= opaque_layers[key.row][key.col];
+        /* fall back to layer 0 */
+        return layers ? get_highest_layer(layers) : 0;
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
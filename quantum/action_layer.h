@@ -166,5 +166,11 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_TRANSPARENCY_MASK)
+/* refresh the cached set of non-transparent layers, for the whole keymap or a single key */
+void layer_transparency_mask_rebuild(void);
+void layer_transparency_mask_update(uint8_t layer, keypos_t key);
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -6,6 +6,9 @@
 #include "action_tapping.h"
 #include "keycode.h"
 #include "timer.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #ifndef NO_ACTION_TAPPING
 
@@ -149,6 +152,17 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event)) {
         ac_dprintf("\n");
     }
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+    // Make sure a pass runs as soon as the tapping term expires
+    if (IS_EVENT(tapping_key.event)) {
+        uint16_t elapsed = TIMER_DIFF_16(timer_read(), tapping_key.event.time);
+        uint16_t term    = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+        if (elapsed < term) {
+            idle_scheduler_wake_in(term - elapsed);
+        }
+    }
+#    endif
 }
 
 /* Some conditionally defined helper macros to keep process_tapping more
@@ -23,6 +23,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "usb_device_state.h"
 #include <string.h>
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 extern keymap_config_t keymap_config;
 
@@ -213,6 +216,30 @@ bool is_oneshot_layer_active(void) {
     return get_oneshot_layer_state();
 }
 
+#    if defined(IDLE_SCHEDULER_ENABLE) && (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+static void oneshot_wake_at_timeout(uint16_t start) {
+    uint16_t elapsed = TIMER_DIFF_16(timer_read(), start);
+    if (elapsed < ONESHOT_TIMEOUT) {
+        idle_scheduler_wake_in(ONESHOT_TIMEOUT - elapsed);
+    }
+}
+
+/** \brief Requests a pass of the main loop as soon as a pending oneshot times out. */
+void oneshot_request_wake(void) {
+    if (get_oneshot_mods()) {
+        oneshot_wake_at_timeout(oneshot_time);
+    }
+    if (get_oneshot_layer_state() && !(get_oneshot_layer_state() & ONESHOT_TOGGLED)) {
+        oneshot_wake_at_timeout(oneshot_layer_time);
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot == SHO_ACTIVE) {
+        oneshot_wake_at_timeout(oneshot_swaphands_time);
+    }
+#        endif
+}
+#    endif
+
 /** \brief set oneshot
  *
  * FIXME: needs doc
@@ -19,6 +19,9 @@
         PROFILE_CALL_NAMED(1000, "matrix_task", {
             matrix_task();
         });
+
+    When PROFILER_ENABLE is set, the calls are recorded as zones of the
+    hierarchical profiler instead -- see profiler.h.
 */
 
 #if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
@@ -26,10 +29,16 @@
 #elif defined(PROTOCOL_CHIBIOS)
 #    define TIMESTAMP_GETTER chSysGetRealtimeCounterX()
 #else
-#    error Unknown protocol in use
+// Host test builds, and anything else without a free-running counter, use the
+// (possibly simulated) millisecond timer.
+#    include "timer.h"
+#    define TIMESTAMP_GETTER timer_read32()
 #endif
 
-#ifndef CONSOLE_ENABLE
+#if defined(PROFILER_ENABLE)
+#    include "profiler.h"
+#    define PROFILE_CALL_NAMED(count, name, call) PROFILER_ZONE(name, call)
+#elif !defined(CONSOLE_ENABLE)
 // Can't do anything if we don't have console output enabled.
 #    define PROFILE_CALL_NAMED(count, name, call) \
         do {                                      \
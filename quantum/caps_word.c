@@ -17,6 +17,9 @@
 #include "timer.h"
 #include "action.h"
 #include "action_util.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 /** @brief True when Caps Word is active. */
 static bool caps_word_active = false;
@@ -35,6 +38,12 @@ void caps_word_task(void) {
     if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
         caps_word_off();
     }
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (caps_word_active) {
+        // Make sure a pass runs as soon as the idle timeout expires
+        idle_scheduler_wake_in(TIMER_DIFF_16(idle_timer, timer_read()));
+    }
+#    endif
 }
 
 void caps_word_reset_idle_timer(void) {
@@ -0,0 +1,163 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm with the same behaviour as sym_defer_pk, using vertical counters.
+Bit n of the counters of all the keys in a row is stored in a single matrix_row_t, so every
+key in the row is counted down at once with a few bitwise operations per counter bit.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Width of the counters, just enough to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+typedef struct {
+    matrix_row_t counting;           // keys with a running counter
+    matrix_row_t bits[COUNTER_BITS]; // bit n of each key's remaining time
+} debounce_counters_t;
+
+static debounce_counters_t debounce_counters[MATRIX_ROWS];
+static fast_timer_t        last_time;
+static bool                counters_need_update;
+static bool                cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // No counter starts above DEBOUNCE, so anything longer expires them all the same
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    matrix_row_t elapsed_bits[COUNTER_BITS];
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        elapsed_bits[bit] = (elapsed_time & (1 << bit)) ? ~(matrix_row_t)0 : 0;
+    }
+
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        debounce_counters_t *counters = &debounce_counters[row];
+        if (!counters->counting) {
+            continue;
+        }
+
+        // Ripple-borrow subtraction of the elapsed time from every counter in the row
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            matrix_row_t counter_bit = counters->bits[bit];
+            matrix_row_t elapsed_bit = elapsed_bits[bit];
+            matrix_row_t difference  = counter_bit ^ elapsed_bit ^ borrow;
+
+            borrow              = (~counter_bit & (elapsed_bit | borrow)) | (elapsed_bit & borrow);
+            counters->bits[bit] = difference;
+            remaining |= difference;
+        }
+
+        // Counters that reached zero or went below it have expired
+        matrix_row_t expired = counters->counting & (borrow | ~remaining);
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+            counters->counting &= ~expired;
+        }
+
+        if (counters->counting) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        debounce_counters_t *counters = &debounce_counters[row];
+        matrix_row_t         delta    = raw[row] ^ cooked[row];
+        matrix_row_t         start    = delta & ~counters->counting;
+
+        if (start) {
+            for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+                if (DEBOUNCE & (1 << bit)) {
+                    counters->bits[bit] |= start;
+                } else {
+                    counters->bits[bit] &= ~start;
+                }
+            }
+            counters_need_update = true;
+        }
+
+        // Keys that are back to their debounced state stop counting
+        counters->counting = delta;
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,64 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+
+extern "C" {
+#include "debounce.h"
+#include "matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// Average cost of a debounce() call, scanning ten times per millisecond. Each
+// millisecond, every key has a `toggle_percent` chance of changing state.
+static double scan_ns(unsigned toggle_percent) {
+    const unsigned scans_per_ms = 10;
+    const unsigned duration_ms  = 20000;
+
+    std::mt19937                            rng(1);
+    std::uniform_int_distribution<unsigned> percent(0, 99);
+    matrix_row_t                            raw[MATRIX_ROWS]    = {0};
+    matrix_row_t                            cooked[MATRIX_ROWS] = {0};
+
+    debounce_init(MATRIX_ROWS);
+    set_time(1000);
+
+    std::chrono::steady_clock::duration total{0};
+    for (unsigned ms = 0; ms < duration_ms; ms++) {
+        bool changed = false;
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (toggle_percent && percent(rng) < toggle_percent) {
+                    raw[row] ^= (matrix_row_t)1 << col;
+                    changed = true;
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned scan = 0; scan < scans_per_ms; scan++) {
+            debounce(raw, cooked, MATRIX_ROWS, changed && scan == 0);
+        }
+        total += std::chrono::steady_clock::now() - start;
+        advance_time(1);
+    }
+
+    debounce_free();
+    return std::chrono::duration<double, std::nano>(total).count() / (duration_ms * scans_per_ms);
+}
+
+TEST(DebounceBenchmark, benchmark) {
+    printf("[ BENCHMARK] debounce %s: idle %.1f ns/scan, typing %.1f ns/scan, chattering %.1f ns/scan\n", STR(DEBOUNCE_ALGORITHM), scan_ns(0), scan_ns(1), scan_ns(20));
+}
@@ -5,38 +5,166 @@
 #include <timer.h>
 #include <deferred_exec.h>
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+// Heap positions are 8 bits wide, so larger tables only use the first 255 entries
+#define MAX_TABLE_COUNT 255
+
 //------------------------------------
 // Helpers
 //
+// Each table holds a permutation of its slots, threaded through the entries:
+// table[pos].heap_slot is the slot at position pos, and table[slot].heap_pos is
+// the position of that slot. Positions are split into three regions:
+//
+//   [0, heap_size)                          pending executors, as a binary min-heap on trigger time
+//   [heap_size, heap_size + ready_count)    executors that are due, while the task is invoking them
+//   [heap_size + ready_count, table_count)  free slots
+//
+// The region sizes live in the first entry of the table. Tokens encode the slot
+// (token = slot + 1 + generation * table_count), so finding an executor from its
+// token, allocating, extending and cancelling never scan the table. Tokens are
+// 16 bits wide so that a slot goes through thousands of generations before one
+// of its tokens comes round again, even when it is the only one being reused.
 
-static deferred_token current_token = 0;
+static inline size_t usable_count(size_t table_count) {
+    return table_count > MAX_TABLE_COUNT ? MAX_TABLE_COUNT : table_count;
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline bool triggers_before(deferred_executor_t *table, uint8_t pos_a, uint8_t pos_b) {
+    return ((int32_t)TIMER_DIFF_32(table[table[pos_a].heap_slot].trigger_time, table[table[pos_b].heap_slot].trigger_time)) < 0;
+}
+
+static inline void swap_positions(deferred_executor_t *table, uint8_t pos_a, uint8_t pos_b) {
+    uint8_t slot_a         = table[pos_a].heap_slot;
+    uint8_t slot_b         = table[pos_b].heap_slot;
+    table[pos_a].heap_slot = slot_b;
+    table[pos_b].heap_slot = slot_a;
+    table[slot_a].heap_pos = pos_b;
+    table[slot_b].heap_pos = pos_a;
+}
+
+static void sift_up(deferred_executor_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!triggers_before(table, pos, parent)) {
+            break;
+        }
+        swap_positions(table, pos, parent);
+        pos = parent;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+}
+
+static void sift_down(deferred_executor_t *table, uint8_t pos) {
+    uint8_t size = table[0].heap_size;
+    while (true) {
+        uint8_t smallest = pos;
+        uint8_t left     = 2 * pos + 1;
+        uint8_t right    = 2 * pos + 2;
+        if (left < size && triggers_before(table, left, smallest)) {
+            smallest = left;
+        }
+        if (right < size && triggers_before(table, right, smallest)) {
+            smallest = right;
         }
+        if (smallest == pos) {
+            break;
+        }
+        swap_positions(table, pos, smallest);
+        pos = smallest;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void ensure_initialised(deferred_executor_t *table, size_t table_count) {
+    if (table[0].initialised) {
+        return;
+    }
+    for (uint8_t i = 0; i < table_count; ++i) {
+        table[i].token      = INVALID_DEFERRED_TOKEN;
+        table[i].heap_pos   = i;
+        table[i].heap_slot  = i;
+        table[i].generation = 0;
+    }
+    table[0].heap_size   = 0;
+    table[0].ready_count = 0;
+    table[0].initialised = true;
+}
+
+static inline bool is_pending(deferred_executor_t *table, deferred_executor_t *entry) {
+    return entry->heap_pos < table[0].heap_size;
+}
+
+static deferred_executor_t *find_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN || !table[0].initialised) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table[(token - 1) % table_count];
+    return entry->token == token ? entry : NULL;
+}
+
+// Moves a pending executor to the start of the ready region
+static void heap_remove(deferred_executor_t *table, deferred_executor_t *entry) {
+    uint8_t pos  = entry->heap_pos;
+    uint8_t last = --table[0].heap_size;
+    table[0].ready_count++;
+    if (pos != last) {
+        swap_positions(table, pos, last);
+        sift_up(table, pos);
+        sift_down(table, pos);
+    }
+}
+
+// Moves a ready executor to the end of the heap, ordered by its trigger time
+static void ready_to_heap(deferred_executor_t *table, deferred_executor_t *entry) {
+    swap_positions(table, entry->heap_pos, table[0].heap_size);
+    table[0].ready_count--;
+    sift_up(table, table[0].heap_size++);
+}
+
+// Releases a ready executor's slot
+static void ready_to_free(deferred_executor_t *table, deferred_executor_t *entry) {
+    swap_positions(table, entry->heap_pos, table[0].heap_size + table[0].ready_count - 1);
+    table[0].ready_count--;
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+static void release_entry(deferred_executor_t *table, deferred_executor_t *entry) {
+    if (is_pending(table, entry)) {
+        heap_remove(table, entry);
+    }
+    ready_to_free(table, entry);
+}
+
+static void reschedule_entry(deferred_executor_t *table, deferred_executor_t *entry, uint32_t trigger_time) {
+    bool later          = ((int32_t)TIMER_DIFF_32(trigger_time, entry->trigger_time)) > 0;
+    entry->trigger_time = trigger_time;
+    if (is_pending(table, entry)) {
+        if (later) {
+            sift_down(table, entry->heap_pos);
+        } else {
+            sift_up(table, entry->heap_pos);
         }
+    } else {
+        ready_to_heap(table, entry);
+    }
+}
+
+static deferred_token allocate_token(size_t table_count, uint8_t slot, uint16_t *generation) {
+    if ((uint32_t)slot + 1 + (uint32_t)(*generation + 1) * table_count > UINT16_MAX) {
+        *generation = 0;
+    } else {
+        ++*generation;
     }
-    return current_token;
+    return slot + 1 + *generation * table_count;
 }
 
 //------------------------------------
@@ -48,28 +176,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
+    table_count = usable_count(table_count);
+    ensure_initialised(table, table_count);
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free slot, if there is one
+    uint8_t free_pos = table[0].heap_size + table[0].ready_count;
+    if (free_pos >= table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
+    deferred_executor_t *entry = &table[table[free_pos].heap_slot];
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    entry->token        = allocate_token(table_count, table[free_pos].heap_slot, &entry->generation);
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+
+    // Make room between the heap and any ready executors, then insert
+    swap_positions(table, free_pos, table[0].heap_size);
+    sift_up(table, table[0].heap_size++);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -78,18 +204,13 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
         return false;
     }
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    reschedule_entry(table, entry, timer_read32() + delay_ms);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -98,62 +219,74 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
         return false;
     }
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    release_entry(table, entry);
+    return true;
+}
+
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || !table[0].initialised || table[0].heap_size == 0) {
+        return false;
+    }
+    *trigger_time = table[table[0].heap_slot].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
+    if (now != *last_execution_time) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        if (!table || table_count == 0 || !table[0].initialised) {
+            return;
+        }
+
+        // Move everything that's due out of the heap first, so that executors re-queued by their callbacks are not
+        // invoked again during this pass, even if they're still behind.
+        while (table[0].heap_size > 0 && ((int32_t)TIMER_DIFF_32(table[table[0].heap_slot].trigger_time, now)) <= 0) {
+            heap_remove(table, &table[table[0].heap_slot]);
+        }
+
+        // Ready executors are ordered latest-first, so work back from the end of the region
+        while (table[0].ready_count > 0) {
+            deferred_executor_t *entry      = &table[table[table[0].heap_size + table[0].ready_count - 1].heap_slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                reschedule_entry(table, entry, entry->trigger_time + delay_ms);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_entry(table, entry);
             }
         }
     }
+
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Make sure a pass runs as soon as the next executor is due
+    uint32_t next_trigger;
+    if (deferred_exec_advanced_next_trigger(table, table_count, &next_trigger)) {
+        idle_scheduler_wake_at(next_trigger);
+    }
+#endif
 }
 
 //------------------------------------
@@ -172,6 +305,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_time_until_next(void) {
+    uint32_t trigger_time;
+    if (!deferred_exec_advanced_next_trigger(basic_executors, MAX_DEFERRED_EXECUTORS, &trigger_time)) {
+        return UINT32_MAX;
+    }
+    int32_t remaining = (int32_t)TIMER_DIFF_32(trigger_time, timer_read32());
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
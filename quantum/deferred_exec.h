@@ -14,7 +14,7 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,6 +60,13 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Queries how long until the next deferred execution is due, e.g. to determine how long the main loop may sleep.
+ *
+ * @return the number of milliseconds until the next deferred execution, 0 if one is overdue, or UINT32_MAX if none are pending
+ */
+uint32_t deferred_exec_time_until_next(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -76,9 +83,16 @@ void deferred_exec_task(void);
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint16_t               generation;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
+    uint8_t                heap_pos;
+    uint8_t                heap_slot;
+    // Only used in the first entry of the table
+    uint8_t heap_size;
+    uint8_t ready_count;
+    bool    initialised;
 } deferred_executor_t;
 
 /**
@@ -110,6 +124,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Queries the trigger time of the next pending deferred execution in a custom table.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the trigger time of the next pending executor -- equivalent time-space as timer_read32()
+ * @return true if an executor is pending, otherwise false
+ */
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -0,0 +1,371 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct Invocation {
+    int      id;
+    uint32_t trigger_time;
+};
+
+static std::vector<Invocation> invocations;
+
+// cb_arg points at the callback's behaviour, so that tests can change it between invocations
+struct Callback {
+    int                           id;
+    uint32_t                      repeat_ms;
+    std::function<void(uint32_t)> during;
+};
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    Callback *cb = static_cast<Callback *>(cb_arg);
+    invocations.push_back({cb->id, trigger_time});
+    if (cb->during) {
+        cb->during(trigger_time);
+    }
+    return cb->repeat_ms;
+}
+
+static const size_t table_count = 8;
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    deferred_executor_t table[table_count];
+    uint32_t            last_exec = 0;
+
+    void SetUp() override {
+        timer_clear();
+        memset(table, 0, sizeof(table));
+        invocations.clear();
+    }
+
+    deferred_token defer(uint32_t delay_ms, Callback *cb) {
+        return defer_exec_advanced(table, table_count, delay_ms, record_callback, cb);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, table_count, &last_exec);
+        }
+    }
+
+    std::vector<int> invoked_ids(void) {
+        std::vector<int> ids;
+        for (auto &inv : invocations) {
+            ids.push_back(inv.id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(DeferredExec, ExecutesOnceAfterDelay) {
+    Callback cb = {1, 0};
+    EXPECT_NE(defer(10, &cb), INVALID_DEFERRED_TOKEN);
+
+    run_for(9);
+    EXPECT_TRUE(invocations.empty());
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    run_for(100);
+    EXPECT_EQ(invocations.size(), 1);
+}
+
+TEST_F(DeferredExec, RejectsInvalidRequests) {
+    Callback cb = {1, 0};
+    EXPECT_EQ(defer_exec_advanced(table, table_count, 0, record_callback, &cb), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, table_count, 10, NULL, &cb), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(NULL, table_count, 10, record_callback, &cb), INVALID_DEFERRED_TOKEN);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, INVALID_DEFERRED_TOKEN));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, table_count, 1, 10));
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTriggerTime) {
+    Callback cb = {1, 5};
+    defer(10, &cb);
+
+    run_for(20);
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    EXPECT_EQ(invocations[1].trigger_time, 15);
+    EXPECT_EQ(invocations[2].trigger_time, 20);
+}
+
+TEST_F(DeferredExec, ExecutesInTriggerOrder) {
+    Callback a = {1, 0}, b = {2, 0}, c = {3, 0};
+    defer(30, &a);
+    defer(10, &b);
+    defer(20, &c);
+
+    run_for(30);
+    EXPECT_EQ(invoked_ids(), (std::vector<int>{2, 3, 1}));
+}
+
+TEST_F(DeferredExec, CancelPreventsExecution) {
+    Callback       a = {1, 0}, b = {2, 0};
+    deferred_token token_a = defer(10, &a);
+    defer(10, &b);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, token_a));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, token_a));
+    run_for(10);
+    EXPECT_EQ(invoked_ids(), (std::vector<int>{2}));
+}
+
+TEST_F(DeferredExec, ExtendPostponesExecution) {
+    Callback       cb    = {1, 0};
+    deferred_token token = defer(10, &cb);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, token, 10));
+    run_for(9);
+    EXPECT_TRUE(invocations.empty());
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, 15);
+}
+
+TEST_F(DeferredExec, ExtendCanBringExecutionForward) {
+    Callback       a = {1, 0}, b = {2, 0};
+    deferred_token token_a = defer(50, &a);
+    defer(20, &b);
+
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, token_a, 5));
+    run_for(20);
+    EXPECT_EQ(invoked_ids(), (std::vector<int>{1, 2}));
+}
+
+TEST_F(DeferredExec, FullTableRejectsNewExecutors) {
+    Callback cb = {1, 0};
+    for (size_t i = 0; i < table_count; ++i) {
+        EXPECT_NE(defer(10, &cb), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(10, &cb), INVALID_DEFERRED_TOKEN);
+
+    run_for(10);
+    EXPECT_EQ(invocations.size(), table_count);
+    EXPECT_NE(defer(10, &cb), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, ReusedSlotsGetNewTokens) {
+    Callback       cb    = {1, 0};
+    deferred_token first = defer(10, &cb);
+    cancel_deferred_exec_advanced(table, table_count, first);
+    deferred_token second = defer(10, &cb);
+
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, first));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, second));
+}
+
+TEST_F(DeferredExec, SlotReusedManyTimesKeepsTokensUnique) {
+    // The same slot is handed out every time, as nothing else is in flight
+    Callback                    cb     = {1, 0};
+    std::vector<deferred_token> issued = {defer(10, &cb)};
+    for (int i = 0; i < 1000; ++i) {
+        cancel_deferred_exec_advanced(table, table_count, issued.back());
+        deferred_token token = defer(10, &cb);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        for (deferred_token stale : issued) {
+            ASSERT_NE(token, stale);
+        }
+        issued.push_back(token);
+    }
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, issued.front()));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, issued.back()));
+}
+
+TEST_F(DeferredExec, CallbackCanCancelAnotherDueExecutor) {
+    Callback       a = {1, 0}, b = {2, 0};
+    deferred_token token_b = INVALID_DEFERRED_TOKEN;
+    a.during               = [&](uint32_t) { EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, token_b)); };
+    defer(10, &a);
+    token_b = defer(11, &b);
+
+    // Both are due in the same pass
+    run_for(5);
+    advance_time(10);
+    deferred_exec_advanced_task(table, table_count, &last_exec);
+    EXPECT_EQ(invoked_ids(), (std::vector<int>{1}));
+}
+
+TEST_F(DeferredExec, CallbackCanRequeueIntoItsOwnSlot) {
+    Callback       cb    = {1, 0};
+    deferred_token token = defer(10, &cb);
+    cb.during            = [&](uint32_t) {
+        cancel_deferred_exec_advanced(table, table_count, token);
+        token = defer(3, &cb);
+    };
+
+    run_for(16);
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[0].trigger_time, 10);
+    EXPECT_EQ(invocations[1].trigger_time, 13);
+    EXPECT_EQ(invocations[2].trigger_time, 16);
+}
+
+TEST_F(DeferredExec, CallbackCanExtendItself) {
+    Callback       cb    = {1, 0};
+    deferred_token token = defer(10, &cb);
+    cb.during            = [&](uint32_t) { extend_deferred_exec_advanced(table, table_count, token, 20); };
+
+    // Returning zero still ends repeated execution, as before
+    run_for(100);
+    EXPECT_EQ(invocations.size(), 1);
+}
+
+TEST_F(DeferredExec, LateExecutorsRunOncePerPass) {
+    Callback cb = {1, 1};
+    defer(1, &cb);
+
+    // Fall 10ms behind: the executor should not be invoked 10 times in one pass
+    advance_time(10);
+    deferred_exec_advanced_task(table, table_count, &last_exec);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, 1);
+
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[1].trigger_time, 2);
+}
+
+TEST_F(DeferredExec, NextTriggerIsEarliestPending) {
+    uint32_t trigger_time = 0;
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+
+    Callback       a = {1, 0}, b = {2, 0};
+    deferred_token token_b = defer(40, &b);
+    defer(25, &a);
+    EXPECT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+    EXPECT_EQ(trigger_time, 25);
+
+    run_for(25);
+    EXPECT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+    EXPECT_EQ(trigger_time, 40);
+
+    cancel_deferred_exec_advanced(table, table_count, token_b);
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+}
+
+TEST_F(DeferredExec, BasicApiTimeUntilNext) {
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+
+    Callback       cb    = {1, 0};
+    deferred_token token = defer_exec(30, record_callback, &cb);
+    EXPECT_EQ(deferred_exec_time_until_next(), 30);
+
+    advance_time(10);
+    EXPECT_EQ(deferred_exec_time_until_next(), 20);
+
+    advance_time(25);
+    EXPECT_EQ(deferred_exec_time_until_next(), 0);
+
+    deferred_exec_task();
+    EXPECT_EQ(invocations.size(), 1);
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+    EXPECT_FALSE(cancel_deferred_exec(token));
+}
+
+// Drives random defer/extend/cancel traffic against a straightforward model of
+// the expected behaviour, checking every invocation.
+TEST_F(DeferredExec, MatchesModelUnderRandomTraffic) {
+    struct Pending {
+        uint32_t trigger_time;
+        uint32_t repeat_ms;
+    };
+    std::map<int, Pending>        model;
+    std::map<int, deferred_token> tokens;
+    std::vector<Callback>         callbacks(1000);
+    std::mt19937                  rng(42);
+
+    int next_id = 0;
+    for (uint32_t ms = 0; ms < 5000; ++ms) {
+        switch (rng() % 4) {
+            case 0: {
+                if (next_id >= (int)callbacks.size()) break;
+                int      id    = next_id++;
+                uint32_t delay = 1 + rng() % 50;
+                callbacks[id]  = {id, (rng() % 3) ? 0 : (uint32_t)(1 + rng() % 20)};
+
+                deferred_token token = defer(delay, &callbacks[id]);
+                if (model.size() < table_count) {
+                    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+                    model[id]  = {timer_read32() + delay, callbacks[id].repeat_ms};
+                    tokens[id] = token;
+                } else {
+                    ASSERT_EQ(token, INVALID_DEFERRED_TOKEN);
+                }
+            } break;
+            case 1:
+                if (!model.empty()) {
+                    auto it = std::next(model.begin(), rng() % model.size());
+                    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, tokens[it->first]));
+                    model.erase(it);
+                }
+                break;
+            case 2:
+                if (!model.empty()) {
+                    auto     it    = std::next(model.begin(), rng() % model.size());
+                    uint32_t delay = 1 + rng() % 50;
+                    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, tokens[it->first], delay));
+                    it->second.trigger_time = timer_read32() + delay;
+                }
+                break;
+            default:
+                break;
+        }
+
+        uint32_t trigger_time;
+        if (model.empty()) {
+            EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+        } else {
+            uint32_t earliest = UINT32_MAX;
+            for (auto &entry : model) {
+                earliest = std::min(earliest, entry.second.trigger_time);
+            }
+            EXPECT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger_time));
+            EXPECT_EQ(trigger_time, earliest);
+        }
+
+        invocations.clear();
+        run_for(1);
+
+        std::multimap<uint32_t, int> expected;
+        for (auto it = model.begin(); it != model.end();) {
+            if (it->second.trigger_time <= timer_read32()) {
+                expected.insert({it->second.trigger_time, it->first});
+                if (it->second.repeat_ms) {
+                    it->second.trigger_time += it->second.repeat_ms;
+                } else {
+                    tokens.erase(it->first);
+                    it = model.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+
+        ASSERT_EQ(invocations.size(), expected.size()) << "at " << timer_read32() << "ms";
+        for (auto &inv : invocations) {
+            auto match = expected.end();
+            for (auto it = expected.begin(); it != expected.end(); ++it) {
+                if (it->second == inv.id) match = it;
+            }
+            ASSERT_NE(match, expected.end()) << "unexpected invocation of " << inv.id;
+            EXPECT_EQ(match->first, inv.trigger_time);
+        }
+    }
+}
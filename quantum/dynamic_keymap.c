@@ -14,13 +14,16 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "timer.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +104,116 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+#    ifndef DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_BATCH
+#        define DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_BATCH 16
+#    endif
+
+#    define DYNAMIC_KEYMAP_KEY_COUNT (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS)
+
+// Keycodes are held in native byte order, dirty bits are per keycode.
+static uint16_t keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  keymap_cache_dirty[(DYNAMIC_KEYMAP_KEY_COUNT + 7) / 8];
+static bool     keymap_cache_loaded     = false;
+static bool     keymap_cache_has_dirty  = false;
+static uint32_t keymap_cache_last_write = 0;
+
+static void keymap_cache_load(void) {
+    uint8_t *address = (uint8_t *)DYNAMIC_KEYMAP_EEPROM_ADDR;
+    uint8_t  buffer[2 * MATRIX_COLS];
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            eeprom_read_block(buffer, address, sizeof(buffer));
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                keymap_cache[layer][row][column] = (buffer[column * 2] << 8) | buffer[column * 2 + 1];
+            }
+            address += sizeof(buffer);
+        }
+    }
+    memset(keymap_cache_dirty, 0, sizeof(keymap_cache_dirty));
+    keymap_cache_has_dirty = false;
+    keymap_cache_loaded    = true;
+}
+
+static inline uint16_t *keymap_cache_entry(uint16_t index) {
+    return &((uint16_t *)keymap_cache)[index];
+}
+
+static uint16_t keymap_cache_read(uint16_t index) {
+    if (!keymap_cache_loaded) {
+        keymap_cache_load();
+    }
+    return *keymap_cache_entry(index);
+}
+
+static void keymap_cache_write(uint16_t index, uint16_t keycode) {
+    if (!keymap_cache_loaded) {
+        keymap_cache_load();
+    }
+    keymap_cache_last_write = timer_read32();
+    if (*keymap_cache_entry(index) == keycode) {
+        return;
+    }
+    *keymap_cache_entry(index) = keycode;
+    keymap_cache_dirty[index / 8] |= 1 << (index % 8);
+    keymap_cache_has_dirty = true;
+}
+
+static inline bool keymap_cache_is_dirty(uint16_t index) {
+    return keymap_cache_dirty[index / 8] & (1 << (index % 8));
+}
+
+static void keymap_cache_mark_all_dirty(void) {
+    memset(keymap_cache_dirty, 0xFF, sizeof(keymap_cache_dirty));
+    keymap_cache_has_dirty = true;
+}
+
+void dynamic_keymap_init(void) {
+    if (!keymap_cache_loaded) {
+        keymap_cache_load();
+    }
+}
+
+void dynamic_keymap_flush(void) {
+    if (!keymap_cache_has_dirty) {
+        return;
+    }
+
+    // Write back runs of consecutive dirty keycodes as single blocks
+    uint8_t buffer[2 * DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_BATCH];
+    for (uint16_t index = 0; index < DYNAMIC_KEYMAP_KEY_COUNT;) {
+        if (!keymap_cache_is_dirty(index)) {
+            index++;
+            continue;
+        }
+        uint16_t start = index;
+        uint8_t  count = 0;
+        while (index < DYNAMIC_KEYMAP_KEY_COUNT && count < DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_BATCH && keymap_cache_is_dirty(index)) {
+            // Big endian, same as the uncached layout
+            buffer[count * 2]     = *keymap_cache_entry(index) >> 8;
+            buffer[count * 2 + 1] = *keymap_cache_entry(index) & 0xFF;
+            keymap_cache_dirty[index / 8] &= ~(1 << (index % 8));
+            count++;
+            index++;
+        }
+        eeprom_update_block(buffer, (uint8_t *)DYNAMIC_KEYMAP_EEPROM_ADDR + (start * 2), count * 2);
+    }
+    keymap_cache_has_dirty = false;
+}
+
+void dynamic_keymap_task(void) {
+    // Defer writing back until the host has stopped sending changes, so that a
+    // full keymap upload ends up as a handful of block writes.
+    if (keymap_cache_has_dirty && timer_elapsed32(keymap_cache_last_write) >= DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY) {
+        dynamic_keymap_flush();
+    }
+}
+#else
+void dynamic_keymap_init(void) {}
+void dynamic_keymap_flush(void) {}
+void dynamic_keymap_task(void) {}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +225,33 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (!keymap_cache_loaded) {
+        keymap_cache_load();
+    }
+    return keymap_cache[layer][row][column];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    keymap_cache_write((layer * MATRIX_ROWS + row) * MATRIX_COLS + column, keycode);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
+#if defined(LAYER_TRANSPARENCY_MASK) && !defined(NO_ACTION_LAYER)
+    layer_transparency_mask_update(layer, (keypos_t){.row = row, .col = column});
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -165,15 +292,27 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // EEPROM may have been formatted underneath the cache, as eeconfig_init_quantum() does, so write back every
+    // keycode rather than only those that differ from what the cache last saw
+    keymap_cache_mark_all_dirty();
+#endif
+    // Make sure the new keymap is persisted before callers mark EEPROM valid
+    dynamic_keymap_flush();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+            uint16_t keycode = keymap_cache_read((offset + i) / 2);
+            *target          = ((offset + i) & 1) ? (keycode & 0xFF) : (keycode >> 8);
+#else
             *target = eeprom_read_byte(source);
+#endif
         } else {
             *target = 0x00;
         }
@@ -184,15 +323,30 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+            uint16_t keycode = keymap_cache_read((offset + i) / 2);
+            if ((offset + i) & 1) {
+                keycode = (keycode & 0xFF00) | *source;
+            } else {
+                keycode = (keycode & 0x00FF) | (*source << 8);
+            }
+            keymap_cache_write((offset + i) / 2, keycode);
+#else
             eeprom_update_byte(target, *source);
+#endif
         }
         source++;
         target++;
     }
+#if defined(LAYER_TRANSPARENCY_MASK) && !defined(NO_ACTION_LAYER)
+    for (uint16_t i = offset / 2; i < dynamic_keymap_eeprom_size / 2 && i <= (offset + size - 1) / 2; i++) {
+        layer_transparency_mask_update(i / (MATRIX_ROWS * MATRIX_COLS), (keypos_t){.row = (i / MATRIX_COLS) % MATRIX_ROWS, .col = i % MATRIX_COLS});
+    }
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +374,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +388,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -18,6 +18,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifndef DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY
+#    define DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY 500
+#endif
+
+// With DYNAMIC_KEYMAP_RAM_CACHE defined, the keymap is mirrored in RAM and
+// changes are written back to EEPROM once no further changes have been made for
+// DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY milliseconds. These are no-ops otherwise.
+void dynamic_keymap_init(void);
+void dynamic_keymap_task(void);
+void dynamic_keymap_flush(void);
+
 uint8_t  dynamic_keymap_get_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
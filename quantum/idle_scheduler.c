@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "idle_scheduler.h"
+#include "timer.h"
+
+static uint32_t      next_wakeup    = 0;
+static uint32_t      awake_until    = 0;
+static volatile bool wake_requested = true;
+
+static inline bool time_before(uint32_t a, uint32_t b) {
+    return (int32_t)TIMER_DIFF_32(a, b) < 0;
+}
+
+void idle_scheduler_init(void) {
+    next_wakeup    = timer_read32();
+    awake_until    = next_wakeup;
+    wake_requested = true;
+}
+
+void idle_scheduler_wake_at(uint32_t time) {
+    if (time_before(time, next_wakeup)) {
+        next_wakeup = time;
+    }
+}
+
+void idle_scheduler_wake_in(uint32_t delay_ms) {
+    idle_scheduler_wake_at(timer_read32() + delay_ms);
+}
+
+void idle_scheduler_stay_awake(uint32_t duration_ms) {
+    uint32_t until = timer_read32() + duration_ms;
+    if (time_before(awake_until, until)) {
+        awake_until = until;
+    }
+    idle_scheduler_wake_in(1);
+}
+
+void idle_scheduler_matrix_changed(void) {
+    idle_scheduler_stay_awake(IDLE_SCHEDULER_DEBOUNCE_WINDOW);
+}
+
+void idle_scheduler_wake(void) {
+    wake_requested = true;
+    platform_idle_wake();
+}
+
+__attribute__((weak)) void idle_scheduler_wake_init_kb(void) {}
+
+bool idle_scheduler_is_due(void) {
+    return wake_requested || !time_before(timer_read32(), next_wakeup);
+}
+
+uint32_t idle_scheduler_next_wakeup(void) {
+    return next_wakeup;
+}
+
+void idle_scheduler_begin_pass(void) {
+    uint32_t now   = timer_read32();
+    wake_requested = false;
+    next_wakeup    = now + (time_before(now, awake_until) ? 1 : IDLE_SCHEDULER_SCAN_INTERVAL);
+}
+
+void idle_scheduler_task(void) {
+    while (!idle_scheduler_is_due()) {
+        platform_idle_wait(TIMER_DIFF_32(next_wakeup, timer_read32()));
+    }
+    idle_scheduler_begin_pass();
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/* Longest time the main loop may sleep between passes. Key presses are only
+ * seen at this granularity unless the matrix wakes the scheduler from an
+ * interrupt (see idle_scheduler_wake_init_kb()), so keep it at 1 unless the
+ * keyboard does.
+ */
+#ifndef IDLE_SCHEDULER_SCAN_INTERVAL
+#    define IDLE_SCHEDULER_SCAN_INTERVAL 1
+#endif
+
+/* How long the main loop keeps running every millisecond after the raw matrix
+ * changes, so that debounce timers expire on time.
+ */
+#ifndef IDLE_SCHEDULER_DEBOUNCE_WINDOW
+#    ifdef DEBOUNCE
+#        define IDLE_SCHEDULER_DEBOUNCE_WINDOW (DEBOUNCE + 1)
+#    else
+#        define IDLE_SCHEDULER_DEBOUNCE_WINDOW 6
+#    endif
+#endif
+
+/**
+ * \brief Resets the scheduler, so that the next pass runs immediately.
+ */
+void idle_scheduler_init(void);
+
+/**
+ * \brief Requests that the next pass of the main loop runs no later than `time`.
+ *
+ * Tasks call this on every pass they still have work pending; requests are
+ * forgotten once the next pass begins.
+ */
+void idle_scheduler_wake_at(uint32_t time);
+
+/**
+ * \brief Requests that the next pass of the main loop runs within `delay_ms`.
+ *
+ * A delay of zero runs the next pass immediately.
+ */
+void idle_scheduler_wake_in(uint32_t delay_ms);
+
+/**
+ * \brief Keeps the main loop running every millisecond for `duration_ms`.
+ */
+void idle_scheduler_stay_awake(uint32_t duration_ms);
+
+/**
+ * \brief Signals that the raw matrix changed, keeping the main loop awake until
+ * debouncing has settled.
+ */
+void idle_scheduler_matrix_changed(void);
+
+/**
+ * \brief Ends the current sleep and runs the next pass immediately.
+ *
+ * Intended to be called from GPIO and USB interrupt handlers.
+ */
+void idle_scheduler_wake(void);
+
+/**
+ * \brief Keyboard hook, called once the matrix has been initialised: sets up the
+ * interrupts that call idle_scheduler_wake() when a key changes.
+ *
+ * Does nothing by default, in which case the matrix is polled every
+ * IDLE_SCHEDULER_SCAN_INTERVAL.
+ */
+void idle_scheduler_wake_init_kb(void);
+
+/**
+ * \brief Calls idle_scheduler_wake() from an interrupt on either edge of `pin`.
+ *
+ * ChibiOS only, and needs `PAL_USE_CALLBACKS` set to `TRUE` in halconf.h.
+ */
+void idle_scheduler_wake_on_pin(pin_t pin);
+
+/**
+ * \brief Returns whether the next pass of the main loop should run now.
+ */
+bool idle_scheduler_is_due(void);
+
+/**
+ * \brief Returns the time the next pass is due, if nothing wakes the scheduler earlier.
+ */
+uint32_t idle_scheduler_next_wakeup(void);
+
+/**
+ * \brief Starts a new pass, forgetting the wake-up requests made during the previous one.
+ */
+void idle_scheduler_begin_pass(void);
+
+/**
+ * \brief Sleeps until the next pass is due, then starts it.
+ */
+void idle_scheduler_task(void);
+
+/**
+ * \brief Platform hook: sleeps until an interrupt occurs or `timeout_ms` has elapsed.
+ *
+ * Returning early is always allowed.
+ */
+void platform_idle_wait(uint32_t timeout_ms);
+
+/**
+ * \brief Platform hook: ends a `platform_idle_wait()` in progress. Called from interrupt context.
+ */
+void platform_idle_wake(void);
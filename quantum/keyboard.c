@@ -32,6 +32,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiler.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -104,6 +111,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -143,6 +153,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_DOUBLE_BUFFER)
+#    include "wear_leveling.h"
+#endif
+#if defined(SEND_STRING_ENABLE) && defined(SENDSTRING_ASYNC)
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -451,6 +467,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_init();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -461,7 +480,13 @@ void keyboard_init(void) {
     encoder_init();
 #endif
     matrix_init();
+#ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_wake_init_kb();
+#endif
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
     led_init_ports();
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
@@ -563,6 +588,22 @@ static inline void generate_tick_event(void) {
     }
 }
 
+/**
+ * @brief Processes a key event from the matrix, unless it has to wait.
+ *
+ * @return false The event could not be taken yet, and should be left in the matrix
+ */
+static bool matrix_key_event(keyevent_t event) {
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    // Hold keys back until the Unicode code point being typed is finished
+    if (unicode_holds_input()) {
+        return unicode_hold_key_event(event);
+    }
+#endif
+    action_exec(event);
+    return true;
+}
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -578,6 +619,13 @@ static bool matrix_task(void) {
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    keyevent_t held_event;
+    while (unicode_release_key_event(&held_event)) {
+        action_exec(held_event);
+    }
+#endif
+
     matrix_scan();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
@@ -592,6 +640,11 @@ static bool matrix_task(void) {
         return matrix_changed;
     }
 
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Custom matrix implementations may not report raw changes
+    idle_scheduler_matrix_changed();
+#endif
+
     if (debug_config.matrix) {
         matrix_print();
     }
@@ -612,14 +665,19 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef LATENCY_TRACE_ENABLE
+                    event.capture = latency_trace_capture(row, col);
+#endif
+                    if (!matrix_key_event(event)) {
+                        continue;
+                    }
                 }
 
                 switch_events(row, col, key_pressed);
+                matrix_previous[row] ^= col_mask;
             }
         }
-
-        matrix_previous[row] = current_row;
     }
 
     return matrix_changed;
@@ -702,17 +760,58 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_task();
+#endif
 }
 
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_DOUBLE_BUFFER)
+/** \brief Erases the wear-leveling bank retired by the last consolidation, a slice per pass, once input has been idle for a while. */
+static void wear_leveling_erase_task(void) {
+    if (!wear_leveling_erase_pending()) {
+        return;
+    }
+
+    uint32_t idle_time = last_input_activity_elapsed();
+    if (idle_time < WEAR_LEVELING_ERASE_IDLE_TIME) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+        idle_scheduler_wake_in(WEAR_LEVELING_ERASE_IDLE_TIME - idle_time);
+#    endif
+        return;
+    }
+
+    wear_leveling_erase_step();
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (wear_leveling_erase_pending()) {
+        idle_scheduler_wake_in(1);
+    }
+#    endif
+}
+#endif
+
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    PROFILER_ZONE_BEGIN(keyboard_task_zone, "keyboard_task");
+
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+
+    bool matrix_changed = false;
+    PROFILER_ZONE("matrix_task", matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILER_ZONE("quantum_task", quantum_task());
+
+#if defined(SEND_STRING_ENABLE) && defined(SENDSTRING_ASYNC)
+    send_string_async_task();
+#endif
+
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    unicode_task();
+#endif
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -726,7 +825,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILER_ZONE("rgb_matrix_task", rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -795,4 +894,18 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_DOUBLE_BUFFER)
+    wear_leveling_erase_task();
+#endif
+
+#ifdef KEYBOARD_REPORT_SCHEDULER
+    host_keyboard_report_task();
+#endif
+
+    PROFILER_ZONE_END(keyboard_task_zone);
 }
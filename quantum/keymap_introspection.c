@@ -174,6 +174,12 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+static uint16_t key_override_index_buffer[ARRAY_SIZE(key_overrides)];
+
+uint16_t* key_override_index_buffer_raw(void) {
+    return key_override_index_buffer;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,4 +108,7 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get room for one index per key override stored in firmware, used to look up the key overrides by trigger keycode
+uint16_t* key_override_index_buffer_raw(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
@@ -0,0 +1,115 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "latency_trace.h"
+#include "profiler.h"
+
+// Zero marks an event as untraced, so a capture landing on it is nudged.
+#define TAG(ts) ((ts) ? (ts) : 1)
+
+static uint32_t elapsed_since(uint32_t now, uint32_t tag) {
+    uint32_t elapsed = now - tag;
+    // Only a nudged tag can appear to be in the future
+    return elapsed > (UINT32_MAX / 2) ? 0 : elapsed;
+}
+
+static uint32_t     raw_edge[MATRIX_ROWS][MATRIX_COLS];
+static matrix_row_t raw_pending[MATRIX_ROWS];
+
+static uint32_t active_capture     = 0;
+static uint32_t processing_capture = 0;
+static uint32_t processing_start   = 0;
+
+static profiler_zone_id_t zone_total    = PROFILER_ZONE_INVALID;
+static profiler_zone_id_t zone_debounce = PROFILER_ZONE_INVALID;
+static profiler_zone_id_t zone_queue    = PROFILER_ZONE_INVALID;
+static profiler_zone_id_t zone_process  = PROFILER_ZONE_INVALID;
+
+static void register_zones(void) {
+    if (zone_total != PROFILER_ZONE_INVALID) {
+        return;
+    }
+    zone_total    = profiler_register_zone("key_latency", PROFILER_ZONE_INVALID);
+    zone_debounce = profiler_register_zone("latency_debounce", zone_total);
+    zone_queue    = profiler_register_zone("latency_queue", zone_total);
+    zone_process  = profiler_register_zone("latency_process", zone_total);
+}
+
+void latency_trace_raw_scan(const matrix_row_t raw[], const matrix_row_t cooked[], uint8_t row_offset, uint8_t num_rows) {
+    uint32_t now = PROFILER_TIMESTAMP();
+
+    for (uint8_t row = 0; row < num_rows; ++row) {
+        uint8_t      r       = row + row_offset;
+        matrix_row_t pending = raw[row] ^ cooked[row];
+        // keys that started differing from the debounced state, or bounced back
+        matrix_row_t changes = pending ^ raw_pending[r];
+        if (!changes) {
+            continue;
+        }
+
+        matrix_row_t col_mask = 1;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
+            if (changes & col_mask) {
+                raw_edge[r][col] = (pending & col_mask) ? TAG(now) : 0;
+            }
+        }
+        raw_pending[r] = pending;
+    }
+}
+
+uint32_t latency_trace_capture(uint8_t row, uint8_t col) {
+    uint32_t now = PROFILER_TIMESTAMP();
+
+    register_zones();
+    if (row < MATRIX_ROWS && col < MATRIX_COLS && raw_edge[row][col]) {
+        profiler_record(zone_debounce, elapsed_since(now, raw_edge[row][col]));
+        raw_edge[row][col] = 0;
+        raw_pending[row] &= ~((matrix_row_t)1 << col);
+    }
+    return TAG(now);
+}
+
+uint32_t latency_trace_exec_begin(const keyevent_t *event) {
+    uint32_t previous = active_capture;
+    if (event->capture) {
+        active_capture = event->capture;
+    }
+    return previous;
+}
+
+void latency_trace_exec_end(uint32_t previous) {
+    active_capture = previous;
+}
+
+uint32_t latency_trace_active_capture(void) {
+    return active_capture;
+}
+
+uint32_t latency_trace_process_begin(const keyrecord_t *record) {
+    uint32_t previous = processing_capture;
+    if (!record->event.capture) {
+        return previous;
+    }
+
+    uint32_t now = PROFILER_TIMESTAMP();
+    register_zones();
+    profiler_record(zone_queue, elapsed_since(now, record->event.capture));
+    processing_capture = record->event.capture;
+    processing_start   = now;
+    return previous;
+}
+
+void latency_trace_process_end(uint32_t previous) {
+    processing_capture = previous;
+}
+
+void latency_trace_report_sent(void) {
+    if (!processing_capture) {
+        return;
+    }
+
+    uint32_t now = PROFILER_TIMESTAMP();
+    profiler_record(zone_process, now - processing_start);
+    profiler_record(zone_total, elapsed_since(now, processing_capture));
+    // Only the first report caused by an event counts towards its latency
+    processing_capture = 0;
+}
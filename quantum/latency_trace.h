@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    End-to-end key latency tracer.
+
+    Every key event produced by matrix_task() is tagged with a capture
+    timestamp, which travels with the event (as keyevent_t.capture) through the
+    tapping and combo buffers into process_record(). The time spent in each
+    stage is recorded as a profiler zone:
+
+        key_latency           capture -> first HID report caused by the event
+          latency_debounce    raw matrix edge -> capture
+          latency_queue       capture -> process_record() (combo/tapping buffers)
+          latency_process     process_record() -> first HID report
+
+    and can therefore be queried the same way as any other zone, over the
+    console or raw HID -- see profiler.h.
+*/
+
+#include <stdint.h>
+#include "matrix.h"
+#include "action.h"
+
+#ifdef LATENCY_TRACE_ENABLE
+
+/**
+ * @brief Records raw matrix edges that debounce has not yet reported.
+ *
+ * Called by the matrix scan before debouncing.
+ *
+ * @param raw the raw (undebounced) rows for this half
+ * @param cooked the debounced rows for this half, before this scan
+ * @param row_offset index of the first row of this half in the full matrix
+ * @param num_rows number of rows for this half
+ */
+void latency_trace_raw_scan(const matrix_row_t raw[], const matrix_row_t cooked[], uint8_t row_offset, uint8_t num_rows);
+
+/**
+ * @brief Produces the capture tag for a debounced key edge.
+ */
+uint32_t latency_trace_capture(uint8_t row, uint8_t col);
+
+/**
+ * @brief Marks the start of action_exec() for an event.
+ *
+ * Events synthesised while handling it (e.g. combo releases) can pick up the
+ * tag through latency_trace_active_capture().
+ *
+ * @return the previously active tag, to be passed to latency_trace_exec_end()
+ */
+uint32_t latency_trace_exec_begin(const keyevent_t *event);
+void     latency_trace_exec_end(uint32_t previous);
+uint32_t latency_trace_active_capture(void);
+
+/**
+ * @brief Marks the start of process_record() for a record.
+ *
+ * @return opaque state to be passed to latency_trace_process_end()
+ */
+uint32_t latency_trace_process_begin(const keyrecord_t *record);
+void     latency_trace_process_end(uint32_t previous);
+
+/**
+ * @brief Called when a keyboard report is handed to the host driver.
+ */
+void latency_trace_report_sent(void);
+
+#endif // LATENCY_TRACE_ENABLE
@@ -4,6 +4,9 @@
 #include "leader.h"
 #include "timer.h"
 #include "util.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #include <string.h>
 
@@ -45,6 +48,17 @@ void leader_task(void) {
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
     }
+#ifdef IDLE_SCHEDULER_ENABLE
+#    if defined(LEADER_NO_TIMEOUT)
+    bool timer_running = leader_sequence_size > 0;
+#    else
+    bool timer_running = true;
+#    endif
+    if (leader_sequence_active() && timer_running) {
+        // Make sure a pass runs as soon as the sequence times out
+        idle_scheduler_wake_in(LEADER_TIMEOUT + 1 - timer_elapsed(leader_time));
+    }
+#endif
 }
 
 bool leader_sequence_active(void) {
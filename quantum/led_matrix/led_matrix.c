@@ -24,6 +24,9 @@
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
@@ -357,6 +360,16 @@ void led_matrix_task(void) {
             led_task_sync();
             break;
     }
+
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Keep going while a frame is in progress, otherwise sleep until the next one is due
+    if (led_task_state != SYNCING) {
+        idle_scheduler_wake_in(0);
+    } else {
+        uint32_t elapsed = sync_timer_elapsed32(g_led_timer);
+        idle_scheduler_wake_in(elapsed < LED_MATRIX_LED_FLUSH_LIMIT ? LED_MATRIX_LED_FLUSH_LIMIT - elapsed : 0);
+    }
+#endif
 }
 
 void led_matrix_indicators(void) {
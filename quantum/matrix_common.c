@@ -4,6 +4,13 @@
 #include "print.h"
 #include "debug.h"
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -168,6 +175,18 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef IDLE_SCHEDULER_ENABLE
+    if (changed) idle_scheduler_matrix_changed();
+#endif
+
+#ifdef LATENCY_TRACE_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    latency_trace_raw_scan(raw_matrix, matrix + thisHand, thisHand, ROWS_PER_HAND);
+#    else
+    latency_trace_raw_scan(raw_matrix, matrix, 0, ROWS_PER_HAND);
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
@@ -23,6 +23,9 @@
 #include "print.h"
 #include "debug.h"
 #include "mousekey.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
@@ -53,6 +56,14 @@ static int8_t  mousekey_y_inertia = 0; // ...
 static uint16_t mouse_timer = 0;
 #endif
 
+#ifdef IDLE_SCHEDULER_ENABLE
+// Make sure a pass runs as soon as the next movement repeat is due
+static void mousekey_wake_after(uint16_t last_timer, uint16_t interval) {
+    uint16_t elapsed = timer_elapsed(last_timer);
+    idle_scheduler_wake_in(elapsed <= interval ? interval + 1 - elapsed : 1);
+}
+#endif
+
 #ifndef MK_3_SPEED
 
 static uint16_t last_timer_c = 0;
@@ -382,6 +393,15 @@ void mousekey_task(void) {
     }
     // save the state for later
     memcpy(&mouse_report, &tmpmr, sizeof(tmpmr));
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        ifdef MOUSEKEY_INERTIA
+    if (mousekey_frame) mousekey_wake_after(last_timer_c, (mousekey_frame > 1) ? mk_interval : mk_delay * 10);
+#        else
+    if (mouse_report.x || mouse_report.y) mousekey_wake_after(last_timer_c, mousekey_repeat ? mk_interval : mk_delay * 10);
+#        endif
+    if (mouse_report.v || mouse_report.h) mousekey_wake_after(last_timer_w, mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10);
+#    endif
 }
 
 void mousekey_on(uint8_t code) {
@@ -534,6 +554,11 @@ void mousekey_task(void) {
         mousekey_send();
     }
     memcpy(&mouse_report, &tmpmr, sizeof(tmpmr));
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (mouse_report.x || mouse_report.y) mousekey_wake_after(last_timer_c, c_intervals[mk_speed]);
+    if (mouse_report.v || mouse_report.h) mousekey_wake_after(last_timer_w, w_intervals[mk_speed]);
+#    endif
 }
 
 void adjust_speed(void) {
@@ -72,6 +72,22 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_SPI_ASYNC
+/**
+ * @def This controls whether SPI displays send data in the background, so that the next chunk of pixel data can be
+ *      prepared while the previous one is still on the bus. Data is copied into one of two buffers of
+ *      QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE bytes before being sent, at the cost of that RAM.
+ */
+#    define QUANTUM_PAINTER_SPI_ASYNC FALSE
+#endif
+
+#ifndef QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE
+/**
+ * @def This controls the size of each of the two buffers used to send SPI data in the background.
+ */
+#    define QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
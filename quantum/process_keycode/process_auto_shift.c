@@ -19,6 +19,9 @@
 #include "action_util.h"
 #include "timer.h"
 #include "keycodes.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
 #    define AUTO_SHIFT_STARTUP_STATE true /* enabled */
@@ -308,16 +311,22 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  */
 void autoshift_matrix_scan(void) {
     if (autoshift_flags.in_progress) {
-        const uint16_t now = timer_read();
-        if (TIMER_DIFF_16(now, autoshift_time) >=
+        const uint16_t now     = timer_read();
+        const uint16_t elapsed = TIMER_DIFF_16(now, autoshift_time);
 #ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
-            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+        const uint16_t timeout = get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord);
 #else
-            autoshift_timeout
+        const uint16_t timeout = autoshift_timeout;
 #endif
-        ) {
+        if (elapsed >= timeout) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
         }
+#ifdef IDLE_SCHEDULER_ENABLE
+        else {
+            // Make sure a pass runs as soon as the key is held long enough to shift
+            idle_scheduler_wake_in(timeout - elapsed);
+        }
+#endif
     }
 }
 
@@ -16,6 +16,10 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+#    include <stdlib.h>
+#    include <string.h>
+#endif
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +30,12 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -102,6 +112,91 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+/* Inverted index from keycode to the combos containing it, sorted by keycode
+ * and then by combo index so that candidates are visited in the same order as
+ * a full scan. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_index_entry_t;
+
+typedef enum { COMBO_INDEX_STALE, COMBO_INDEX_READY, COMBO_INDEX_OVERFLOW } combo_index_state_t;
+
+static combo_index_entry_t combo_index[COMBO_KEYCODE_INDEX_SIZE];
+static uint16_t            combo_index_size  = 0;
+static combo_index_state_t combo_index_state = COMBO_INDEX_STALE;
+
+/* Combos whose state may need resetting by clear_combos(). Every combo owns at
+ * least one index entry, so the index size also bounds the combo count. */
+static uint8_t combo_touched[(COMBO_KEYCODE_INDEX_SIZE + 7) / 8];
+
+#    define COMBO_TOUCH(idx) (combo_touched[(idx) / 8] |= (1 << ((idx) % 8)))
+
+void clear_combos(void);
+
+static int combo_index_entry_compare(const void *a, const void *b) {
+    const combo_index_entry_t *lhs = a;
+    const combo_index_entry_t *rhs = b;
+    if (lhs->keycode != rhs->keycode) {
+        return lhs->keycode < rhs->keycode ? -1 : 1;
+    }
+    if (lhs->combo_index != rhs->combo_index) {
+        return lhs->combo_index < rhs->combo_index ? -1 : 1;
+    }
+    return 0;
+}
+
+void combo_keycode_index_rebuild(void) {
+    // Combo state is tracked through the index, so start from a clean slate
+    combo_index_state = COMBO_INDEX_STALE;
+    clear_combos();
+    memset(combo_touched, 0, sizeof(combo_touched));
+
+    combo_index_size  = 0;
+    combo_index_state = COMBO_INDEX_READY;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; ++i) {
+            if (combo_index_size >= COMBO_KEYCODE_INDEX_SIZE) {
+                // Too small to index every combo, fall back to scanning
+                combo_index_state = COMBO_INDEX_OVERFLOW;
+                return;
+            }
+            combo_index[combo_index_size++] = (combo_index_entry_t){.keycode = key, .combo_index = idx};
+        }
+    }
+
+    qsort(combo_index, combo_index_size, sizeof(combo_index_entry_t), combo_index_entry_compare);
+
+    // A keycode listed twice in one combo must only visit it once
+    uint16_t unique = 0;
+    for (uint16_t i = 0; i < combo_index_size; ++i) {
+        if (unique == 0 || combo_index_entry_compare(&combo_index[unique - 1], &combo_index[i]) != 0) {
+            combo_index[unique++] = combo_index[i];
+        }
+    }
+    combo_index_size = unique;
+}
+
+/* Returns the position of the first entry for keycode, or of the next larger
+ * keycode if there is none. */
+static uint16_t combo_index_lower_bound(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -155,6 +250,9 @@ static inline void release_combo(uint16_t combo_index, combo_t *combo) {
             .event   = MAKE_COMBOEVENT(false),
             .keycode = combo->keycode,
         };
+#ifdef LATENCY_TRACE_ENABLE
+        record.event.capture = latency_trace_active_capture();
+#endif
 #ifndef NO_ACTION_TAPPING
         action_tapping_process(record);
 #else
@@ -202,6 +300,25 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+    if (combo_index_state == COMBO_INDEX_READY) {
+        for (uint16_t byte = 0; byte < sizeof(combo_touched); ++byte) {
+            if (!combo_touched[byte]) {
+                continue;
+            }
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                if (combo_touched[byte] & (1 << bit)) {
+                    combo_t *combo = combo_get(byte * 8 + bit);
+                    if (!COMBO_ACTIVE(combo)) {
+                        RESET_COMBO_STATE(combo);
+                        combo_touched[byte] &= ~(1 << bit);
+                    }
+                }
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -581,10 +698,26 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+    if (combo_index_state == COMBO_INDEX_STALE) {
+        combo_keycode_index_rebuild();
+    }
+
+    // COMBO_END matches the terminator of every combo, so it keeps the full scan.
+    if (combo_index_state == COMBO_INDEX_READY && keycode != COMBO_END) {
+        for (uint16_t i = combo_index_lower_bound(keycode); i < combo_index_size && combo_index[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_index[i].combo_index;
+            COMBO_TOUCH(idx);
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -644,6 +777,15 @@ void combo_task(void) {
             clear_combos();
         }
     }
+#    ifdef IDLE_SCHEDULER_ENABLE
+    // Make sure a pass runs as soon as the longest combo term expires
+    if (timer) {
+        uint16_t elapsed = timer_elapsed(timer);
+        if (elapsed <= longest_term) {
+            idle_scheduler_wake_in(longest_term + 1 - elapsed);
+        }
+    }
+#    endif
 #endif
 }
 
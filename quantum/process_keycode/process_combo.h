@@ -77,6 +77,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+/* Rebuilds the keycode to combo index. The index is built on first use; call
+ * this if combo_count() or the keys returned by combo_get() change at runtime. */
+void combo_keycode_index_rebuild(void);
+#endif
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
@@ -29,9 +29,6 @@
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
 
-// For benchmarking the time it takes to call process_key_override on every key press (needs keyboard debugging enabled as well)
-// #define BENCH_KEY_OVERRIDE
-
 // For debug output (needs keyboard debugging enabled as well)
 // #define DEBUG_KEY_OVERRIDE
 
@@ -84,6 +81,17 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+// The key overrides ordered by trigger keycode, keeping the keymap order among those with the same trigger, so that an event only looks at the overrides it can activate. Built on first use. NULL if there are more overrides than room in the index, in which case all trigger_index_count overrides are looked at in order.
+static uint16_t *trigger_index       = NULL;
+static uint16_t  trigger_index_count = 0;
+static bool      trigger_index_built = false;
+
+// A range of trigger_index, or of the key overrides themselves without an index
+typedef struct {
+    uint16_t pos;
+    uint16_t end;
+} override_run_t;
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -243,14 +251,122 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
+void key_override_invalidate_index(void) {
+    trigger_index_built = false;
+}
+
+static uint16_t trigger_at(const uint16_t pos) {
+    return key_override_get(trigger_index[pos])->trigger;
+}
+
+static void build_trigger_index(void) {
+    trigger_index_built = true;
+    trigger_index_count = 0;
+
+    const uint16_t count = key_override_count();
+    if (count > key_override_count_raw()) {
+        trigger_index       = NULL;
+        trigger_index_count = count;
+        return;
+    }
+
+    trigger_index = key_override_index_buffer_raw();
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        // Insertion sort, which keeps overrides with the same trigger in keymap order
+        uint16_t pos = trigger_index_count++;
+        while (pos > 0 && trigger_at(pos - 1) > override->trigger) {
+            trigger_index[pos] = trigger_index[pos - 1];
+            pos--;
+        }
+        trigger_index[pos] = i;
+    }
+}
+
+/** Finds the overrides with the given trigger. */
+static override_run_t find_trigger_run(const uint16_t trigger) {
+    override_run_t run = {0, trigger_index_count};
+
+    while (run.pos < run.end) {
+        const uint16_t mid = run.pos + (run.end - run.pos) / 2;
+        if (trigger_at(mid) < trigger) {
+            run.pos = mid + 1;
+        } else {
+            run.end = mid;
+        }
+    }
+
+    run.end = run.pos;
+    while (run.end < trigger_index_count && trigger_at(run.end) == trigger) {
+        run.end++;
+    }
+    return run;
+}
+
+/** Adds the overrides with the given trigger to the runs to look at, unless already added. */
+static uint8_t add_trigger_run(override_run_t *runs, uint16_t *triggers, uint8_t run_count, const uint16_t trigger) {
+    for (uint8_t i = 0; i < run_count; i++) {
+        if (triggers[i] == trigger) {
+            return run_count;
+        }
+    }
+
+    triggers[run_count] = trigger;
+    runs[run_count]     = find_trigger_run(trigger);
+    return run_count + 1;
+}
+
 /** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_override_count() == 0) {
         return true;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    if (!trigger_index_built) {
+        build_trigger_index();
+    }
+
+    // Only overrides without a trigger, triggered by the key just pressed, or triggered by the last key that is still down can activate
+    override_run_t runs[3];
+    uint8_t        run_count = 0;
+
+    if (trigger_index == NULL) {
+        runs[run_count++] = (override_run_t){0, trigger_index_count};
+    } else {
+        uint16_t triggers[3];
+        run_count = add_trigger_run(runs, triggers, run_count, KC_NO);
+        if (key_down) {
+            run_count = add_trigger_run(runs, triggers, run_count, keycode);
+        }
+        run_count = add_trigger_run(runs, triggers, run_count, last_key_down);
+    }
+
+    while (true) {
+        // Take the override that comes first in the keymap from the runs, so that the first matching override wins as before
+        uint8_t  next  = run_count;
+        uint16_t index = 0;
+        for (uint8_t r = 0; r < run_count; r++) {
+            if (runs[r].pos < runs[r].end) {
+                const uint16_t candidate = trigger_index == NULL ? runs[r].pos : trigger_index[runs[r].pos];
+                if (next == run_count || candidate < index) {
+                    next  = r;
+                    index = candidate;
+                }
+            }
+        }
+
+        if (next == run_count) {
+            break;
+        }
+        runs[next].pos++;
+
+        const key_override_t *const override = key_override_get(index);
 
         // End of array
         if (override == NULL) {
@@ -406,10 +522,6 @@ void key_override_task(void) {
 }
 
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
-#ifdef BENCH_KEY_OVERRIDE
-    uint16_t start = timer_read();
-#endif
-
     const bool key_down = record->event.pressed;
     const bool is_mod   = IS_MODIFIER_KEYCODE(keycode);
 
@@ -519,11 +631,5 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
         }
     }
 
-#ifdef BENCH_KEY_OVERRIDE
-    uint16_t elapsed = timer_elapsed(start);
-
-    dprintf("Processing key overrides took: %u ms\n", elapsed);
-#endif
-
     return send_key_action;
 }
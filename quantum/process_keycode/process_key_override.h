@@ -105,6 +105,9 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/** Rebuilds the lookup of key overrides by trigger before the next key event. Call this if the overrides returned by key_override_get() change at runtime. */
+void key_override_invalidate_index(void);
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
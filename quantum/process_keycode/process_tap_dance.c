@@ -22,6 +22,9 @@
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
@@ -186,7 +189,17 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td) return;
+
+    uint16_t elapsed = timer_elapsed(last_tap_time);
+    uint16_t term    = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+    if (elapsed <= term) {
+#ifdef IDLE_SCHEDULER_ENABLE
+        // Make sure a pass runs as soon as the tapping term expires
+        idle_scheduler_wake_in(term + 1 - elapsed);
+#endif
+        return;
+    }
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
@@ -0,0 +1,264 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include "profiler.h"
+#include "print.h"
+#include "util.h"
+
+typedef struct {
+    profiler_zone_id_t zone;
+    uint32_t           start;
+} profiler_frame_t;
+
+static profiler_zone_stats_t zones[PROFILER_MAX_ZONES];
+static uint8_t               zone_count = 0;
+
+static profiler_frame_t stack[PROFILER_MAX_DEPTH];
+static uint8_t          stack_depth = 0;
+
+static profiler_sample_t ring[PROFILER_RING_SIZE];
+static volatile uint16_t ring_head    = 0; // written by the producer only
+static volatile uint16_t ring_tail    = 0; // written by the consumer only
+static uint32_t          ring_dropped = 0;
+
+static void reset_zone_stats(profiler_zone_stats_t *stats) {
+    stats->count = 0;
+    stats->min   = UINT32_MAX;
+    stats->max   = 0;
+    stats->total = 0;
+    memset(stats->histogram, 0, sizeof(stats->histogram));
+}
+
+static uint8_t histogram_bucket(uint32_t duration) {
+    uint8_t bucket = 0;
+    while (duration) {
+        ++bucket;
+        duration >>= 1;
+    }
+    return MIN(bucket, PROFILER_HISTOGRAM_BUCKETS - 1);
+}
+
+static uint32_t histogram_bucket_upper(uint8_t bucket) {
+    if (bucket >= 32) {
+        return UINT32_MAX;
+    }
+    return (((uint32_t)1) << bucket) - 1;
+}
+
+profiler_zone_id_t profiler_find_zone(const char *name) {
+    for (uint8_t i = 0; i < zone_count; ++i) {
+        if (zones[i].name == name || strcmp(zones[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return PROFILER_ZONE_INVALID;
+}
+
+profiler_zone_id_t profiler_register_zone(const char *name, profiler_zone_id_t parent) {
+    profiler_zone_id_t zone = profiler_find_zone(name);
+    if (zone != PROFILER_ZONE_INVALID || zone_count >= PROFILER_MAX_ZONES) {
+        return zone;
+    }
+
+    profiler_zone_stats_t *stats = &zones[zone_count];
+    stats->name                  = name;
+    stats->parent                = parent < zone_count ? parent : PROFILER_ZONE_INVALID;
+    stats->depth                 = parent < zone_count ? zones[parent].depth + 1 : 0;
+    reset_zone_stats(stats);
+    return zone_count++;
+}
+
+static profiler_zone_id_t current_zone(void) {
+    for (uint8_t i = MIN(stack_depth, PROFILER_MAX_DEPTH); i > 0; --i) {
+        if (stack[i - 1].zone != PROFILER_ZONE_INVALID) {
+            return stack[i - 1].zone;
+        }
+    }
+    return PROFILER_ZONE_INVALID;
+}
+
+void profiler_zone_begin(profiler_zone_id_t *zone, const char *name) {
+    if (*zone == PROFILER_ZONE_INVALID) {
+        // Nesting is resolved from the first call site that enters the zone.
+        *zone = profiler_register_zone(name, current_zone());
+    }
+
+    if (stack_depth < PROFILER_MAX_DEPTH) {
+        stack[stack_depth].zone = *zone;
+        // Sample the timestamp last so that registration is not included
+        stack[stack_depth].start = PROFILER_TIMESTAMP();
+    }
+    ++stack_depth;
+}
+
+void profiler_zone_end(profiler_zone_id_t zone) {
+    uint32_t now = PROFILER_TIMESTAMP();
+
+    if (stack_depth == 0) {
+        return;
+    }
+    --stack_depth;
+
+    if (stack_depth < PROFILER_MAX_DEPTH && stack[stack_depth].zone == zone) {
+        profiler_record(zone, now - stack[stack_depth].start);
+    }
+}
+
+void profiler_record(profiler_zone_id_t zone, uint32_t duration) {
+    if (zone >= zone_count) {
+        return;
+    }
+
+    profiler_zone_stats_t *stats = &zones[zone];
+    stats->count++;
+    stats->total += duration;
+    if (duration < stats->min) {
+        stats->min = duration;
+    }
+    if (duration > stats->max) {
+        stats->max = duration;
+    }
+
+    uint16_t *bucket = &stats->histogram[histogram_bucket(duration)];
+    if (*bucket < UINT16_MAX) {
+        ++*bucket;
+    }
+
+    uint16_t head = ring_head;
+    if ((uint16_t)(head - ring_tail) >= PROFILER_RING_SIZE) {
+        ++ring_dropped;
+        return;
+    }
+    ring[head & (PROFILER_RING_SIZE - 1)] = (profiler_sample_t){.zone = zone, .duration = duration};
+    ring_head                             = head + 1;
+}
+
+bool profiler_ring_pop(profiler_sample_t *sample) {
+    uint16_t tail = ring_tail;
+    if (tail == ring_head) {
+        return false;
+    }
+    *sample   = ring[tail & (PROFILER_RING_SIZE - 1)];
+    ring_tail = tail + 1;
+    return true;
+}
+
+uint32_t profiler_ring_dropped(void) {
+    return ring_dropped;
+}
+
+void profiler_reset(void) {
+    for (uint8_t i = 0; i < zone_count; ++i) {
+        reset_zone_stats(&zones[i]);
+    }
+    ring_tail    = ring_head;
+    ring_dropped = 0;
+}
+
+uint8_t profiler_zone_count(void) {
+    return zone_count;
+}
+
+const profiler_zone_stats_t *profiler_get_zone(profiler_zone_id_t zone) {
+    return zone < zone_count ? &zones[zone] : NULL;
+}
+
+uint32_t profiler_zone_avg(profiler_zone_id_t zone) {
+    if (zone >= zone_count || zones[zone].count == 0) {
+        return 0;
+    }
+    return (uint32_t)(zones[zone].total / zones[zone].count);
+}
+
+uint32_t profiler_zone_p99(profiler_zone_id_t zone) {
+    if (zone >= zone_count || zones[zone].count == 0) {
+        return 0;
+    }
+
+    const profiler_zone_stats_t *stats = &zones[zone];
+
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < PROFILER_HISTOGRAM_BUCKETS; ++i) {
+        samples += stats->histogram[i];
+    }
+
+    uint32_t target     = samples - (samples / 100);
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < PROFILER_HISTOGRAM_BUCKETS; ++i) {
+        cumulative += stats->histogram[i];
+        if (cumulative >= target) {
+            return MIN(histogram_bucket_upper(i), stats->max);
+        }
+    }
+    return stats->max;
+}
+
+static void print_zone_tree(profiler_zone_id_t parent) {
+    for (uint8_t i = 0; i < zone_count; ++i) {
+        const profiler_zone_stats_t *stats = &zones[i];
+        if (stats->parent != parent) {
+            continue;
+        }
+        for (uint8_t d = 0; d < stats->depth; ++d) {
+            xprintf("  ");
+        }
+        xprintf("%s: n=%lu min=%lu max=%lu avg=%lu p99=%lu\n", stats->name, (unsigned long)stats->count, (unsigned long)(stats->count ? stats->min : 0), (unsigned long)stats->max, (unsigned long)profiler_zone_avg(i), (unsigned long)profiler_zone_p99(i));
+        print_zone_tree(i);
+    }
+}
+
+void profiler_print(void) {
+    xprintf("profiler: %u zones, %lu samples dropped\n", (unsigned)zone_count, (unsigned long)ring_dropped);
+    print_zone_tree(PROFILER_ZONE_INVALID);
+}
+
+static void write_u32(uint8_t *dest, uint32_t value) {
+    dest[0] = value & 0xFF;
+    dest[1] = (value >> 8) & 0xFF;
+    dest[2] = (value >> 16) & 0xFF;
+    dest[3] = (value >> 24) & 0xFF;
+}
+
+bool profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != PROFILER_RAW_HID_COMMAND_ID) {
+        return false;
+    }
+
+    uint8_t command = data[1];
+    uint8_t index   = length > 2 ? data[2] : 0;
+    memset(&data[2], 0, length - 2);
+
+    switch (command) {
+        case PROFILER_RAW_HID_GET_ZONE_COUNT:
+            if (length > 2) {
+                data[2] = zone_count;
+            }
+            break;
+        case PROFILER_RAW_HID_GET_ZONE: {
+            // [2] index, [3] parent, [4] depth, then count/min/max/avg/p99 as
+            // little-endian u32, then as much of the name as fits.
+            const uint8_t name_offset = 25;
+            if (length <= name_offset || index >= zone_count) {
+                data[1] = PROFILER_ZONE_INVALID;
+                break;
+            }
+            const profiler_zone_stats_t *stats = &zones[index];
+            data[2]                            = index;
+            data[3]                            = stats->parent;
+            data[4]                            = stats->depth;
+            write_u32(&data[5], stats->count);
+            write_u32(&data[9], stats->count ? stats->min : 0);
+            write_u32(&data[13], stats->max);
+            write_u32(&data[17], profiler_zone_avg(index));
+            write_u32(&data[21], profiler_zone_p99(index));
+            strncpy((char *)&data[name_offset], stats->name, length - name_offset - 1);
+        } break;
+        case PROFILER_RAW_HID_RESET:
+            profiler_reset();
+            break;
+        default:
+            data[1] = PROFILER_ZONE_INVALID;
+            break;
+    }
+    return true;
+}
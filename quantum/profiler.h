@@ -0,0 +1,212 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Hierarchical zone profiler.
+
+    Zones are identified by name, are registered on first use, and remember the
+    zone that was active when they were first entered so that the report can be
+    printed as a tree. Every completed zone records its duration (in platform
+    timestamp ticks -- CPU cycles where available) into per-zone statistics, a
+    log2 histogram and a lock-free ring of recent samples.
+
+    Usage example:
+
+        #include "profiler.h"
+
+        // Wrap a statement or block:
+        PROFILER_ZONE("matrix_task", changed = matrix_task());
+
+        // Or bracket a region that may contain early returns:
+        PROFILER_ZONE_BEGIN(my_zone, "my_zone");
+        do_something();
+        PROFILER_ZONE_END(my_zone);
+
+    All of the above compile away entirely unless PROFILER_ENABLE is defined.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef PROFILER_MAX_ZONES
+#    define PROFILER_MAX_ZONES 16
+#endif // PROFILER_MAX_ZONES
+
+#ifndef PROFILER_MAX_DEPTH
+#    define PROFILER_MAX_DEPTH 8
+#endif // PROFILER_MAX_DEPTH
+
+#ifndef PROFILER_RING_SIZE
+#    define PROFILER_RING_SIZE 64
+#endif // PROFILER_RING_SIZE
+
+#if (PROFILER_RING_SIZE & (PROFILER_RING_SIZE - 1)) != 0
+#    error PROFILER_RING_SIZE must be a power of two
+#endif
+
+#ifndef PROFILER_HISTOGRAM_BUCKETS
+#    define PROFILER_HISTOGRAM_BUCKETS 24
+#endif // PROFILER_HISTOGRAM_BUCKETS
+
+#ifndef PROFILER_RAW_HID_COMMAND_ID
+#    define PROFILER_RAW_HID_COMMAND_ID 0xF0
+#endif // PROFILER_RAW_HID_COMMAND_ID
+
+#ifndef PROFILER_TIMESTAMP
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        define PROFILER_TIMESTAMP() ((uint32_t)chSysGetRealtimeCounterX())
+#    else
+// AVR and the host test platform fall back to the millisecond timer; the test
+// platform's timer is simulated, so zone durations are fully deterministic.
+#        include "timer.h"
+#        define PROFILER_TIMESTAMP() timer_read32()
+#    endif
+#endif // PROFILER_TIMESTAMP
+
+#define PROFILER_ZONE_INVALID 0xFF
+
+typedef uint8_t profiler_zone_id_t;
+
+typedef struct {
+    const char        *name;
+    profiler_zone_id_t parent;
+    uint8_t            depth;
+    uint32_t           count;
+    uint32_t           min;
+    uint32_t           max;
+    uint64_t           total;
+    uint16_t           histogram[PROFILER_HISTOGRAM_BUCKETS];
+} profiler_zone_stats_t;
+
+typedef struct {
+    profiler_zone_id_t zone;
+    uint32_t           duration;
+} profiler_sample_t;
+
+typedef enum {
+    PROFILER_RAW_HID_GET_ZONE_COUNT = 0x01,
+    PROFILER_RAW_HID_GET_ZONE       = 0x02,
+    PROFILER_RAW_HID_RESET          = 0x03,
+} profiler_raw_hid_command_t;
+
+#ifdef PROFILER_ENABLE
+
+/**
+ * @brief Enters a zone, registering it on first use.
+ *
+ * @param zone cached zone ID, updated when the zone is first registered
+ * @param name zone name, must have static storage duration
+ */
+void profiler_zone_begin(profiler_zone_id_t *zone, const char *name);
+
+/**
+ * @brief Leaves the zone most recently entered, recording its duration.
+ *
+ * @param zone the zone being left
+ */
+void profiler_zone_end(profiler_zone_id_t zone);
+
+/**
+ * @brief Registers a zone without entering it, e.g. for durations measured
+ * outside of the zone stack and fed in with profiler_record().
+ *
+ * @param name zone name, must have static storage duration
+ * @param parent parent zone, or PROFILER_ZONE_INVALID for a top level zone
+ * @return the zone ID, or PROFILER_ZONE_INVALID if the zone table is full
+ */
+profiler_zone_id_t profiler_register_zone(const char *name, profiler_zone_id_t parent);
+
+/**
+ * @brief Records an externally measured duration against a zone.
+ */
+void profiler_record(profiler_zone_id_t zone, uint32_t duration);
+
+/**
+ * @brief Clears all collected statistics and samples. Registered zones are kept.
+ */
+void profiler_reset(void);
+
+/**
+ * @brief Number of zones registered so far.
+ */
+uint8_t profiler_zone_count(void);
+
+/**
+ * @brief Statistics for a zone, or NULL if the zone ID is not registered.
+ */
+const profiler_zone_stats_t *profiler_get_zone(profiler_zone_id_t zone);
+
+/**
+ * @brief Looks up a registered zone by name.
+ *
+ * @return the zone ID, or PROFILER_ZONE_INVALID if no such zone was registered
+ */
+profiler_zone_id_t profiler_find_zone(const char *name);
+
+/**
+ * @brief Average duration of a zone, in timestamp ticks.
+ */
+uint32_t profiler_zone_avg(profiler_zone_id_t zone);
+
+/**
+ * @brief Estimates the 99th percentile duration of a zone from its histogram.
+ *
+ * The result is the upper bound of the histogram bucket containing the 99th
+ * percentile sample, clamped to the observed maximum.
+ */
+uint32_t profiler_zone_p99(profiler_zone_id_t zone);
+
+/**
+ * @brief Pops the oldest sample from the sample ring.
+ *
+ * @return false if the ring is empty
+ */
+bool profiler_ring_pop(profiler_sample_t *sample);
+
+/**
+ * @brief Number of samples discarded because the ring was full.
+ */
+uint32_t profiler_ring_dropped(void);
+
+/**
+ * @brief Prints the zone tree and statistics over the console.
+ */
+void profiler_print(void);
+
+/**
+ * @brief Handles a profiler request received over raw HID.
+ *
+ * Call from raw_hid_receive() (or raw_hid_receive_kb() when VIA is enabled);
+ * if this returns true the buffer has been replaced with the response, which
+ * should be sent back with raw_hid_send().
+ */
+bool profiler_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#    define PROFILER_ZONE_BEGIN(var, name)                     \
+        static profiler_zone_id_t var = PROFILER_ZONE_INVALID; \
+        profiler_zone_begin(&var, (name))
+
+#    define PROFILER_ZONE_END(var) profiler_zone_end(var)
+
+#    define PROFILER_ZONE(name, ...)                                          \
+        do {                                                                  \
+            static profiler_zone_id_t profiler_zone_ = PROFILER_ZONE_INVALID; \
+            profiler_zone_begin(&profiler_zone_, (name));                     \
+            do {                                                              \
+                __VA_ARGS__;                                                  \
+            } while (0);                                                      \
+            profiler_zone_end(profiler_zone_);                                \
+        } while (0)
+
+#else
+
+#    define PROFILER_ZONE_BEGIN(var, name)
+#    define PROFILER_ZONE_END(var)
+#    define PROFILER_ZONE(name, ...) \
+        do {                         \
+            __VA_ARGS__;             \
+        } while (0)
+
+#endif // PROFILER_ENABLE
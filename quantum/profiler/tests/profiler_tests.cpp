@@ -0,0 +1,134 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "profiler.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+// Zones stay registered for the lifetime of the process, so each test uses its
+// own names and only relies on statistics it produced itself.
+class Profiler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        profiler_reset();
+    }
+
+    void timed_zone(profiler_zone_id_t *zone, const char *name, uint32_t duration) {
+        profiler_zone_begin(zone, name);
+        advance_time(duration);
+        profiler_zone_end(*zone);
+    }
+
+    void drain_ring(void) {
+        profiler_sample_t sample;
+        while (profiler_ring_pop(&sample)) {
+        }
+    }
+};
+
+TEST_F(Profiler, RecordsMinMaxAvg) {
+    profiler_zone_id_t zone = PROFILER_ZONE_INVALID;
+
+    timed_zone(&zone, "stats", 10);
+    timed_zone(&zone, "stats", 30);
+    timed_zone(&zone, "stats", 20);
+
+    ASSERT_NE(zone, PROFILER_ZONE_INVALID);
+    const profiler_zone_stats_t *stats = profiler_get_zone(zone);
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->count, 3);
+    EXPECT_EQ(stats->min, 10);
+    EXPECT_EQ(stats->max, 30);
+    EXPECT_EQ(profiler_zone_avg(zone), 20);
+    EXPECT_EQ(profiler_find_zone("stats"), zone);
+}
+
+TEST_F(Profiler, NestedZonesRecordParent) {
+    profiler_zone_id_t outer = PROFILER_ZONE_INVALID;
+    profiler_zone_id_t inner = PROFILER_ZONE_INVALID;
+
+    profiler_zone_begin(&outer, "outer");
+    advance_time(5);
+    timed_zone(&inner, "inner", 7);
+    advance_time(3);
+    profiler_zone_end(outer);
+
+    const profiler_zone_stats_t *outer_stats = profiler_get_zone(outer);
+    const profiler_zone_stats_t *inner_stats = profiler_get_zone(inner);
+    ASSERT_NE(outer_stats, nullptr);
+    ASSERT_NE(inner_stats, nullptr);
+    EXPECT_EQ(inner_stats->parent, outer);
+    EXPECT_EQ(inner_stats->depth, outer_stats->depth + 1);
+    EXPECT_EQ(inner_stats->max, 7);
+    EXPECT_EQ(outer_stats->max, 15);
+}
+
+TEST_F(Profiler, P99FromHistogram) {
+    profiler_zone_id_t zone = PROFILER_ZONE_INVALID;
+
+    for (int i = 0; i < 99; ++i) {
+        timed_zone(&zone, "p99", 3);
+    }
+    timed_zone(&zone, "p99", 1000);
+
+    // 99 of 100 samples fall in the [2, 3] bucket
+    EXPECT_EQ(profiler_zone_p99(zone), 3);
+
+    timed_zone(&zone, "p99", 1000);
+    EXPECT_EQ(profiler_zone_p99(zone), 1000);
+}
+
+TEST_F(Profiler, RingDropsWhenFull) {
+    profiler_zone_id_t zone = PROFILER_ZONE_INVALID;
+    drain_ring();
+
+    for (uint32_t i = 0; i < PROFILER_RING_SIZE + 3; ++i) {
+        timed_zone(&zone, "ring", i);
+    }
+    EXPECT_EQ(profiler_ring_dropped(), 3);
+
+    profiler_sample_t sample;
+    for (uint32_t i = 0; i < PROFILER_RING_SIZE; ++i) {
+        ASSERT_TRUE(profiler_ring_pop(&sample));
+        EXPECT_EQ(sample.zone, zone);
+        EXPECT_EQ(sample.duration, i);
+    }
+    EXPECT_FALSE(profiler_ring_pop(&sample));
+}
+
+TEST_F(Profiler, RawHidZoneQuery) {
+    profiler_zone_id_t zone = PROFILER_ZONE_INVALID;
+    timed_zone(&zone, "hid", 42);
+
+    uint8_t data[32] = {PROFILER_RAW_HID_COMMAND_ID, PROFILER_RAW_HID_GET_ZONE, zone};
+    ASSERT_TRUE(profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], PROFILER_RAW_HID_GET_ZONE);
+    EXPECT_EQ(data[2], zone);
+    EXPECT_EQ(data[5], 1);  // count
+    EXPECT_EQ(data[13], 42); // max
+    EXPECT_STREQ((const char *)&data[25], "hid");
+
+    uint8_t other[32] = {0x01, PROFILER_RAW_HID_GET_ZONE};
+    EXPECT_FALSE(profiler_raw_hid_receive(other, sizeof(other)));
+}
+
+// Keep this test last, it exhausts the zone table.
+TEST_F(Profiler, ZoneLimitIsHonoured) {
+    // Names must outlive the profiler, which keeps the pointers.
+    static char names[PROFILER_MAX_ZONES + 1][16];
+
+    for (int i = 0; i <= PROFILER_MAX_ZONES; ++i) {
+        snprintf(names[i], sizeof(names[i]), "limit_%d", i);
+        profiler_zone_id_t zone = PROFILER_ZONE_INVALID;
+        timed_zone(&zone, names[i], 1);
+    }
+
+    EXPECT_EQ(profiler_zone_count(), PROFILER_MAX_ZONES);
+    EXPECT_EQ(profiler_find_zone(names[PROFILER_MAX_ZONES]), PROFILER_ZONE_INVALID);
+}
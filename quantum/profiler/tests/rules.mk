@@ -0,0 +1,7 @@
+profiler_DEFS := -DPROFILER_ENABLE -DNO_PRINT -DPROFILER_RING_SIZE=8
+
+profiler_SRC := \
+	$(QUANTUM_PATH)/profiler/tests/profiler_tests.cpp \
+	$(QUANTUM_PATH)/profiler.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
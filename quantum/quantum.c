@@ -84,6 +84,10 @@
 #    include "process_layer_lock.h"
 #endif
 
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -208,6 +212,10 @@ __attribute__((weak)) void suspend_wakeup_init_modules(void) {}
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#ifdef KEYBOARD_REPORT_SCHEDULER
+    // Let the host see the keys released before the reset
+    host_keyboard_report_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -230,6 +238,14 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    // Keymap edits still waiting in the RAM cache go to EEPROM first
+    dynamic_keymap_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    // Write out anything the EEPROM driver is holding back, before the reset loses it
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -292,6 +308,31 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* The process_* handlers are each registered with the keycodes they act on, so
+ * that a plain key skips the handlers for feature keycodes without calling
+ * them. Handlers that have to see every event, for example to record keys or
+ * cancel a pending state, are registered for all keycodes. */
+#ifdef PROCESS_RECORD_HANDLER_STATS
+static process_record_handler_stats_t handler_stats;
+
+process_record_handler_stats_t process_record_get_handler_stats(void) {
+    return handler_stats;
+}
+
+void process_record_clear_handler_stats(void) {
+    memset(&handler_stats, 0, sizeof(handler_stats));
+}
+
+#    define HANDLER_CALLED() (++handler_stats.called, true)
+#    define HANDLER_SKIPPED() (++handler_stats.skipped, true)
+#else
+#    define HANDLER_CALLED() true
+#    define HANDLER_SKIPPED() true
+#endif // PROCESS_RECORD_HANDLER_STATS
+
+#define PROCESS_ALL_KEYCODES(handler) (HANDLER_CALLED() && handler(keycode, record))
+#define PROCESS_KEYCODES(handler, first, last) ((keycode < (first) || keycode > (last)) ? HANDLER_SKIPPED() : (HANDLER_CALLED() && handler(keycode, record)))
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -339,105 +380,114 @@ bool process_record_quantum(keyrecord_t *record) {
 #endif
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
             // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_dynamic_macro) &&
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_last_key) &&
+            PROCESS_ALL_KEYCODES(process_repeat_key) &&
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_clicky) &&
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_haptic) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_auto_mouse) &&
 #endif
-            process_record_modules(keycode, record) && // modules must run before kb
-            process_record_kb(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_record_modules) && // modules must run before kb
+            PROCESS_ALL_KEYCODES(process_record_kb) &&
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+            PROCESS_KEYCODES(process_record_via, QK_MACRO, QK_MACRO_MAX) &&
 #endif
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+            PROCESS_KEYCODES(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_KEYCODES(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_KEYCODES(process_midi, QK_MIDI, QK_MIDI_MAX) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_KEYCODES(process_audio, QK_AUDIO, QK_AUDIO_MAX) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_KEYCODES(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_led_matrix, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_KEYCODES(process_steno, QK_STENO, QK_STENO_MAX) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+            // Music mode plays the keys it is handed, whatever they are.
+            PROCESS_ALL_KEYCODES(process_music) &&
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_caps_word) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_key_override) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_tap_dance) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    if defined(UCIS_ENABLE)
+            // UCIS reads the name of the character from plain keys.
+            PROCESS_ALL_KEYCODES(process_unicode_common) &&
+#    else
+            PROCESS_KEYCODES(process_unicode_common, QK_UNICODE_MODE_NEXT, QK_UNICODE_MAX) &&
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_leader) &&
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_auto_shift) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_KEYCODES(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+            // Any other key press cancels a pending space cadet tap.
+            PROCESS_ALL_KEYCODES(process_space_cadet) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_KEYCODES(process_magic, QK_MAGIC, QK_MAGIC_MAX) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_KEYCODES(process_grave_esc, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            PROCESS_KEYCODES(process_underglow, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            PROCESS_KEYCODES(process_rgb_matrix, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_KEYCODES(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_KEYCODES(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            PROCESS_ALL_KEYCODES(process_autocorrect) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            PROCESS_KEYCODES(process_default_layer, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+            // Unlocks layers that something else turned off, on any event.
+            PROCESS_ALL_KEYCODES(process_layer_lock) &&
 #endif
 #ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
+            PROCESS_KEYCODES(process_connection, QK_CONNECTION, QK_CONNECTION_MAX) &&
 #endif
             true)) {
         return false;
@@ -550,6 +600,13 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 void suspend_power_down_quantum(void) {
     suspend_power_down_modules();
     suspend_power_down_kb();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    // Write out anything the EEPROM driver is holding back, in case power goes with the host
+    eeprom_driver_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
@@ -268,6 +268,16 @@ bool     process_record_user(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_kb(uint16_t keycode, keyrecord_t *record);
 void     post_process_record_user(uint16_t keycode, keyrecord_t *record);
 
+#ifdef PROCESS_RECORD_HANDLER_STATS
+typedef struct {
+    uint32_t called;  // handlers called by process_record_quantum()
+    uint32_t skipped; // handlers skipped as the keycode is out of their range
+} process_record_handler_stats_t;
+
+process_record_handler_stats_t process_record_get_handler_stats(void);
+void                           process_record_clear_handler_stats(void);
+#endif
+
 void reset_keyboard(void);
 void soft_reset_keyboard(void);
 
@@ -4,10 +4,23 @@
 
 typedef hsv_t (*reactive_f)(hsv_t hsv, uint16_t offset);
 
+// Whether any key hit is still fading out.
+static bool reactive_hits_active(uint16_t max_tick) {
+    for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+        if (g_last_hit_tracker.tick[j] < max_tick) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint16_t max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+    if (params->iter == 0 && !reactive_hits_active(max_tick) && rgb_matrix_frame_unchanged(params, 0)) {
+        return false;
+    }
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         uint16_t tick = max_tick;
@@ -48,6 +48,18 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        endif
 }
 
+// Whether any key with an LED still has some heat left.
+static bool typing_heatmap_is_warm(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (g_rgb_frame_buffer[row][col] && g_led_config.matrix_co[row][col] != NO_LED) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 // A timer to track the last time we decremented all heatmap values.
 static uint16_t heatmap_decrease_timer;
 // Whether we should decrement the heatmap values during the next update.
@@ -71,6 +83,11 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         if (decrease_heatmap_values) {
             heatmap_decrease_timer = timer_read();
         }
+
+        // Once every key has cooled down the heatmap stays the same until the next key press
+        if (!typing_heatmap_is_warm() && rgb_matrix_frame_unchanged(params, 0)) {
+            return false;
+        }
     }
 
     // Render heatmap & decrease
@@ -23,6 +23,9 @@
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
@@ -77,6 +80,17 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+// incremental rendering
+static bool     rgb_effect_drawing = false; // the current effect is drawing
+static bool     rgb_frame_dirty    = true;  // LEDs were written since the last flush
+static bool     rgb_frame_reusable = false; // the previous frame was drawn by the effect alone
+static bool     rgb_frame_recorded = false; // the effect recorded its state for this frame
+static uint32_t rgb_frame_state    = 0;
+static uint32_t rgb_frame_config   = 0;
+#ifdef RGB_MATRIX_FRAME_STATS
+static rgb_matrix_frame_stats_t rgb_frame_stats;
+#endif // RGB_MATRIX_FRAME_STATS
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -152,7 +166,20 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
     return index;
 }
 
+static void rgb_matrix_mark_dirty(uint8_t count) {
+    rgb_frame_dirty = true;
+    if (!rgb_effect_drawing) {
+        // Indicators or user code drew over the frame, so the effect has to redraw it
+        rgb_frame_reusable = false;
+        rgb_frame_recorded = false;
+    }
+#ifdef RGB_MATRIX_FRAME_STATS
+    rgb_frame_stats.led_writes += count;
+#endif // RGB_MATRIX_FRAME_STATS
+}
+
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_matrix_mark_dirty(1);
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
@@ -161,10 +188,40 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+    rgb_matrix_mark_dirty(RGB_MATRIX_LED_COUNT);
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
 
+bool rgb_matrix_frame_unchanged(effect_params_t *params, uint32_t state) {
+    if (params->iter != 0) {
+        return false;
+    }
+
+    uint32_t config    = ((uint32_t)rgb_matrix_config.speed << 24) | ((uint32_t)rgb_matrix_config.hsv.h << 16) | ((uint32_t)rgb_matrix_config.hsv.s << 8) | rgb_matrix_config.hsv.v;
+    bool     unchanged = rgb_frame_reusable && !params->init && state == rgb_frame_state && config == rgb_frame_config;
+
+    rgb_frame_state    = state;
+    rgb_frame_config   = config;
+    rgb_frame_recorded = true;
+#ifdef RGB_MATRIX_FRAME_STATS
+    if (unchanged) {
+        rgb_frame_stats.frames_skipped++;
+    }
+#endif // RGB_MATRIX_FRAME_STATS
+    return unchanged;
+}
+
+#ifdef RGB_MATRIX_FRAME_STATS
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void) {
+    return rgb_frame_stats;
+}
+
+void rgb_matrix_clear_frame_stats(void) {
+    memset(&rgb_frame_stats, 0, sizeof(rgb_frame_stats));
+}
+#endif // RGB_MATRIX_FRAME_STATS
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -277,6 +334,13 @@ static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+    // the previous frame can only be kept if its effect recorded what it drew
+    rgb_frame_reusable = rgb_frame_recorded;
+    rgb_frame_recorded = false;
+#ifdef RGB_MATRIX_FRAME_STATS
+    rgb_frame_stats.frames++;
+#endif // RGB_MATRIX_FRAME_STATS
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -297,6 +361,7 @@ static void rgb_task_render(uint8_t effect) {
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
+    rgb_effect_drawing = true;
     switch (effect) {
         case RGB_MATRIX_NONE:
             rendering = rgb_matrix_none(&rgb_effect_params);
@@ -330,10 +395,12 @@ static void rgb_task_render(uint8_t effect) {
         // Factory default magic value
         case UINT8_MAX: {
             rgb_matrix_test();
-            rgb_task_state = FLUSHING;
+            rgb_effect_drawing = false;
+            rgb_task_state     = FLUSHING;
         }
             return;
     }
+    rgb_effect_drawing = false;
 
     rgb_effect_params.iter++;
 
@@ -352,8 +419,16 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
-    // update pwm buffers
-    rgb_matrix_update_pwm_buffers();
+    // update pwm buffers, unless nothing was drawn since the last flush
+    if (rgb_frame_dirty) {
+        rgb_frame_dirty = false;
+        rgb_matrix_update_pwm_buffers();
+#ifdef RGB_MATRIX_FRAME_STATS
+        rgb_frame_stats.flushes++;
+    } else {
+        rgb_frame_stats.flushes_skipped++;
+#endif // RGB_MATRIX_FRAME_STATS
+    }
 
     // next task
     rgb_task_state = SYNCING;
@@ -392,6 +467,16 @@ void rgb_matrix_task(void) {
             rgb_task_sync();
             break;
     }
+
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Keep going while a frame is in progress, otherwise sleep until the next one is due
+    if (rgb_task_state != SYNCING) {
+        idle_scheduler_wake_in(0);
+    } else {
+        uint32_t elapsed = sync_timer_elapsed32(g_rgb_timer);
+        idle_scheduler_wake_in(elapsed < RGB_MATRIX_LED_FLUSH_LIMIT ? RGB_MATRIX_LED_FLUSH_LIMIT - elapsed : 0);
+    }
+#endif
 }
 
 void rgb_matrix_indicators(void) {
@@ -114,6 +114,24 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+#ifdef RGB_MATRIX_FRAME_STATS
+typedef struct {
+    uint32_t frames;          // frames started
+    uint32_t frames_skipped;  // frames the effect declared unchanged
+    uint32_t led_writes;      // LEDs written, by effects and indicators
+    uint32_t flushes;         // driver flushes
+    uint32_t flushes_skipped; // flushes skipped as no LED was written
+} rgb_matrix_frame_stats_t;
+
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void);
+void                     rgb_matrix_clear_frame_stats(void);
+#endif
+
+// Lets an effect skip drawing a frame identical to the previous one. The current
+// colour and speed are compared automatically, `state` holds anything else the
+// output depends on. Only meaningful on the first iteration of a frame.
+bool rgb_matrix_frame_unchanged(effect_params_t *params, uint32_t state);
+
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
 
@@ -21,6 +21,10 @@
 #include "color.h"
 #include "util.h"
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #if defined(RGB_MATRIX_KEYPRESSES) || defined(RGB_MATRIX_KEYRELEASES)
 #    define RGB_MATRIX_KEYREACTIVE_ENABLED
 #endif
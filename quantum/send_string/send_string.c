@@ -24,6 +24,14 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SENDSTRING_ASYNC
+#    include "timer.h"
+#    include "eeprom.h"
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        include "idle_scheduler.h"
+#    endif
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -326,3 +334,272 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
 #endif
+
+#ifdef SENDSTRING_ASYNC
+/* Queued send_string
+ *
+ * Rather than typing a string in one go, each queued string is read a token at
+ * a time: a character or an SS_TAP/SS_DOWN/SS_UP/SS_DELAY sequence is expanded
+ * into the presses and releases the blocking functions above would make, each
+ * followed by the time to wait before the next one. send_string_async_task()
+ * then plays those steps back from keyboard_task(), returning to the main loop
+ * whenever it has to wait, or once it has used up its budget for the pass.
+ */
+
+#    ifndef SENDSTRING_ASYNC_QUEUE_SIZE
+#        define SENDSTRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+#    ifndef SENDSTRING_ASYNC_EVENTS_PER_TASK
+#        define SENDSTRING_ASYNC_EVENTS_PER_TASK 4
+#    endif
+
+#    ifndef SENDSTRING_ASYNC_TASK_BUDGET
+#        define SENDSTRING_ASYNC_TASK_BUDGET 1
+#    endif
+
+_Static_assert(SENDSTRING_ASYNC_QUEUE_SIZE > 0 && SENDSTRING_ASYNC_QUEUE_SIZE <= 255, "SENDSTRING_ASYNC_QUEUE_SIZE must be between 1 and 255");
+_Static_assert(SENDSTRING_ASYNC_EVENTS_PER_TASK > 0, "SENDSTRING_ASYNC_EVENTS_PER_TASK must be at least 1");
+
+// Worst case for a single character: shift, AltGr, the key itself and a dead key space
+#    define SENDSTRING_ASYNC_MAX_STEPS 8
+
+typedef struct send_string_async_job_t {
+    char (*getter)(void *);
+    void                      *arg;
+    send_string_memory_state_t state;
+    uint8_t                    interval;
+} send_string_async_job_t;
+
+typedef struct send_string_async_step_t {
+    uint8_t  keycode;
+    bool     pressed;
+    uint16_t delay;
+} send_string_async_step_t;
+
+static send_string_async_job_t  job_queue[SENDSTRING_ASYNC_QUEUE_SIZE];
+static uint8_t                  job_head  = 0;
+static uint8_t                  job_count = 0;
+static send_string_async_step_t steps[SENDSTRING_ASYNC_MAX_STEPS];
+static uint8_t                  step_head  = 0;
+static uint8_t                  step_count = 0;
+static uint32_t                 wait_start = 0;
+static uint32_t                 wait_time  = 0;
+
+static void send_string_async_push_step(uint8_t keycode, bool pressed, uint16_t delay) {
+    steps[step_count++] = (send_string_async_step_t){.keycode = keycode, .pressed = pressed, .delay = delay};
+}
+
+static void send_string_async_wait(uint32_t ms) {
+    wait_start = timer_read32();
+    wait_time  = ms;
+}
+
+static void send_string_async_push_char(char ascii_code, uint8_t interval) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        send_string_async_push_step(KC_LEFT_SHIFT, true, interval);
+    }
+    if (is_altgred) {
+        send_string_async_push_step(KC_RIGHT_ALT, true, interval);
+    }
+    send_string_async_push_step(keycode, true, interval);
+    send_string_async_push_step(keycode, false, interval);
+    if (is_altgred) {
+        send_string_async_push_step(KC_RIGHT_ALT, false, interval);
+    }
+    if (is_shifted) {
+        send_string_async_push_step(KC_LEFT_SHIFT, false, interval);
+    }
+    if (is_dead) {
+        send_string_async_push_step(KC_SPACE, true, TAP_CODE_DELAY);
+        send_string_async_push_step(KC_SPACE, false, interval);
+    }
+}
+
+/** \brief Reads the next token of a job into the step list. Returns false once the job has reached its end. */
+static bool send_string_async_fetch(send_string_async_job_t *job) {
+    char ascii_code = job->getter(job->arg);
+    if (!ascii_code) {
+        return false;
+    }
+    if (ascii_code != SS_QMK_PREFIX) {
+        send_string_async_push_char(ascii_code, job->interval);
+        return true;
+    }
+
+    ascii_code = job->getter(job->arg);
+    if (ascii_code == SS_TAP_CODE) {
+        uint8_t keycode = job->getter(job->arg);
+        send_string_async_push_step(keycode, true, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+        send_string_async_push_step(keycode, false, job->interval);
+    } else if (ascii_code == SS_DOWN_CODE) {
+        send_string_async_push_step(job->getter(job->arg), true, job->interval);
+    } else if (ascii_code == SS_UP_CODE) {
+        send_string_async_push_step(job->getter(job->arg), false, job->interval);
+    } else {
+        uint32_t ms = 0;
+        if (ascii_code == SS_DELAY_CODE) {
+            ascii_code = job->getter(job->arg);
+            while (isdigit(ascii_code)) {
+                ms *= 10;
+                ms += ascii_code - '0';
+                ascii_code = job->getter(job->arg);
+            }
+        }
+        send_string_async_wait(ms + job->interval);
+
+        // if we had a delay that terminated with a null, we're done
+        if (ascii_code == 0) return false;
+    }
+    return true;
+}
+
+static void send_string_async_pop_job(void) {
+    job_head = (job_head + 1) % SENDSTRING_ASYNC_QUEUE_SIZE;
+    job_count--;
+}
+
+void send_string_async_task(void) {
+    if (wait_time) {
+        if (timer_elapsed32(wait_start) < wait_time) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+            idle_scheduler_wake_at(wait_start + wait_time);
+#    endif
+            return;
+        }
+        wait_time = 0;
+    }
+
+    uint32_t start  = timer_read32();
+    uint8_t  events = 0;
+    while (!wait_time && events < SENDSTRING_ASYNC_EVENTS_PER_TASK && timer_elapsed32(start) < SENDSTRING_ASYNC_TASK_BUDGET) {
+        if (step_head == step_count) {
+            step_head  = 0;
+            step_count = 0;
+            if (!job_count) {
+                return;
+            }
+            if (!send_string_async_fetch(&job_queue[job_head])) {
+                send_string_async_pop_job();
+            }
+            continue;
+        }
+
+        send_string_async_step_t *step = &steps[step_head++];
+        if (step->pressed) {
+            register_code(step->keycode);
+        } else {
+            unregister_code(step->keycode);
+        }
+        events++;
+        if (step->delay) {
+            send_string_async_wait(step->delay);
+        }
+    }
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (wait_time) {
+        idle_scheduler_wake_at(wait_start + wait_time);
+    } else if (send_string_async_busy()) {
+        idle_scheduler_wake_in(0);
+    }
+#    endif
+}
+
+bool send_string_async_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    if (job_count >= SENDSTRING_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+
+    send_string_async_job_t *job = &job_queue[(job_head + job_count) % SENDSTRING_ASYNC_QUEUE_SIZE];
+    job->getter                  = getter;
+    job->arg                     = arg;
+    job->interval                = interval;
+    job_count++;
+    return true;
+}
+
+/** \brief Queues one of the built-in sources, whose read position lives in the job itself. */
+static bool send_string_async_queue_memory(char (*getter)(void *), const char *string, uint8_t interval) {
+    if (job_count >= SENDSTRING_ASYNC_QUEUE_SIZE) {
+        return false;
+    }
+
+    send_string_async_job_t *job = &job_queue[(job_head + job_count) % SENDSTRING_ASYNC_QUEUE_SIZE];
+    job->state.string            = string;
+    return send_string_async_with_delay_impl(getter, &job->state, interval);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    return send_string_async_queue_memory(send_string_get_next_ram, string, interval);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_P(const char *string) {
+    return send_string_async_with_delay_P(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    return send_string_async_queue_memory(send_string_get_next_progmem, string, interval);
+}
+#    endif
+
+static char send_string_get_next_eeprom(void *arg) {
+    send_string_memory_state_t *state = (send_string_memory_state_t *)arg;
+    char                        ret   = eeprom_read_byte((const uint8_t *)state->string);
+    state->string++;
+    return ret;
+}
+
+bool send_string_async_with_delay_eeprom(const void *address, uint8_t interval) {
+    return send_string_async_queue_memory(send_string_get_next_eeprom, (const char *)address, interval);
+}
+
+uint8_t send_string_async_queue_free(void) {
+    return SENDSTRING_ASYNC_QUEUE_SIZE - job_count;
+}
+
+bool send_string_async_busy(void) {
+    return job_count || step_head != step_count || wait_time;
+}
+
+void send_string_async_cancel(void) {
+    // Let go of anything the current character still has held, without waiting
+    for (uint8_t i = step_head; i < step_count; i++) {
+        if (steps[i].pressed) {
+            continue;
+        }
+        bool held = true;
+        for (uint8_t j = step_head; j < i; j++) {
+            if (steps[j].pressed && steps[j].keycode == steps[i].keycode) {
+                held = false;
+                break;
+            }
+        }
+        if (held) {
+            unregister_code(steps[i].keycode);
+        }
+    }
+    step_head  = 0;
+    step_count = 0;
+    job_head   = 0;
+    job_count  = 0;
+    wait_time  = 0;
+}
+#endif
@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -169,4 +170,109 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SENDSTRING_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out. It is read as it is typed, so it must remain valid until typing has finished.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * Unlike `send_string_with_delay()`, this returns straight away; the string is typed out by `send_string_async_task()`
+ * over the following passes of the main loop, so the matrix keeps being scanned while it types.
+ *
+ * \param string The string to type out. It is read as it is typed, so it must remain valid until typing has finished.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, 0).
+ *
+ * \param string The string to type out.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async_P(const char *string);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_P(string) send_string_async_with_delay(string, 0)
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Queue a NUL-terminated string stored in EEPROM to be typed out in the background, with a delay between each character.
+ *
+ * \param address The EEPROM address of the first character. The string is read as it is typed, so it should not be changed until typing has finished.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async_with_delay_eeprom(const void *address, uint8_t interval);
+
+/**
+ * \brief Queue a string returned by a getter function, as `send_string_with_delay_impl()` does.
+ *
+ * `arg` is not copied, so it must remain valid until typing has finished.
+ *
+ * \return `false` if the queue is full and the string was not queued.
+ */
+bool send_string_async_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), interval).
+ */
+#    define SEND_STRING_ASYNC_DELAY(string, interval) send_string_async_with_delay_P(PSTR(string), interval)
+
+/**
+ * \brief Returns how many more strings can be queued before the queue is full.
+ */
+uint8_t send_string_async_queue_free(void);
+
+/**
+ * \brief Returns whether any queued strings are still being typed.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Drops every queued string, releasing the keys of the character being typed.
+ *
+ * Keys pressed with `SS_DOWN()` earlier in the string are left held.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Types out queued strings, stopping whenever it has to wait. Called from `keyboard_task()`.
+ */
+void send_string_async_task(void);
+#endif
+
 /** \} */
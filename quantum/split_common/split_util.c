@@ -22,6 +22,9 @@
 #include "debug.h"
 #include "usb_util.h"
 #include "bootloader.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #ifdef EE_HANDS
 #    include "eeconfig.h"
@@ -115,6 +118,9 @@ void split_watchdog_task(void) {
         if (timer_elapsed32(split_watchdog_started) > SPLIT_WATCHDOG_TIMEOUT) {
             mcu_reset();
         }
+#    ifdef IDLE_SCHEDULER_ENABLE
+        idle_scheduler_wake_at(split_watchdog_started + SPLIT_WATCHDOG_TIMEOUT + 1);
+#    endif
     }
 }
 #endif // defined(SPLIT_WATCHDOG_ENABLE)
@@ -240,6 +246,9 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
     static uint16_t connection_check_timer = 0;
     const bool      is_disconnected        = !is_transport_connected();
     if (is_disconnected && timer_elapsed(connection_check_timer) < SPLIT_CONNECTION_CHECK_TIMEOUT) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+        idle_scheduler_wake_in(SPLIT_CONNECTION_CHECK_TIMEOUT - timer_elapsed(connection_check_timer));
+#    endif
         return false;
     }
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
@@ -0,0 +1,56 @@
+# Both halves run in the same process, over the loopback serial transport
+SPLIT_TRANSPORT_COMMON_DEFS := -DSPLIT_KEYBOARD -DSPLIT_COMMON_TRANSACTIONS -DSERIAL_DRIVER_LOOPBACK -DSPLIT_TRANSPORT_MIRROR -DSPLIT_TRANSACTION_IDS_USER=USER_ECHO -DNO_PRINT -DNO_DEBUG
+SPLIT_TRANSPORT_MATRIX_DEFS := -DMATRIX_ROWS=8 -DMATRIX_COLS=16
+SPLIT_TRANSPORT_COMMON_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+
+SPLIT_TRANSPORT_COMMON_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/serial_loopback.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+split_transport_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS)
+split_transport_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+split_transport_batch_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) -DSPLIT_TRANSPORT_BATCH
+split_transport_batch_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_batch_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+split_transport_push_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) -DSPLIT_TRANSPORT_PUSH -DSPLIT_TRANSPORT_POLL_INTERVAL=16 -DFORCED_SYNC_THROTTLE_MS=100
+split_transport_push_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_push_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+# The master's idle scheduler, with a scan interval long enough to show where the transport wakes it
+SPLIT_TRANSPORT_IDLE_DEFS := -DIDLE_SCHEDULER_ENABLE -DIDLE_SCHEDULER_SCAN_INTERVAL=50
+
+split_transport_idle_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) $(SPLIT_TRANSPORT_IDLE_DEFS)
+split_transport_idle_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_idle_SRC := $(SPLIT_TRANSPORT_COMMON_SRC) $(QUANTUM_PATH)/idle_scheduler.c
+
+split_transport_push_idle_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) $(SPLIT_TRANSPORT_IDLE_DEFS) -DSPLIT_TRANSPORT_PUSH -DSPLIT_TRANSPORT_POLL_INTERVAL=16 -DFORCED_SYNC_THROTTLE_MS=100
+split_transport_push_idle_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_push_idle_SRC := $(SPLIT_TRANSPORT_COMMON_SRC) $(QUANTUM_PATH)/idle_scheduler.c
+
+# Wide halves, with 5 rows of 32 columns, where sending key events is cheaper than sending the matrix
+split_transport_delta_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) -DMATRIX_ROWS=10 -DMATRIX_COLS=32 -DSPLIT_TRANSPORT_MATRIX_DELTA
+split_transport_delta_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_delta_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+# Encoder steps from the slave, which the master has to tell it to drop once handled
+SPLIT_TRANSPORT_ENCODER_DEFS := -DENCODER_ENABLE -DNUM_ENCODERS_LEFT=2 -DNUM_ENCODERS_RIGHT=2 -DNUM_ENCODERS=4
+
+split_transport_encoder_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) $(SPLIT_TRANSPORT_ENCODER_DEFS)
+split_transport_encoder_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_encoder_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
+
+split_transport_batch_encoder_DEFS := $(SPLIT_TRANSPORT_COMMON_DEFS) $(SPLIT_TRANSPORT_MATRIX_DEFS) $(SPLIT_TRANSPORT_ENCODER_DEFS) -DSPLIT_TRANSPORT_BATCH
+split_transport_batch_encoder_INC := $(SPLIT_TRANSPORT_COMMON_INC)
+split_transport_batch_encoder_SRC := $(SPLIT_TRANSPORT_COMMON_SRC)
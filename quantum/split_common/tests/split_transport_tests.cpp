@@ -0,0 +1,501 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "serial_loopback.h"
+#include "timer.h"
+#include "transactions.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+
+void platform_idle_wait(uint32_t timeout_ms) {}
+
+void platform_idle_wake(void) {}
+#endif
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+bool is_keyboard_master(void) {
+    return !serial_loopback_is_slave();
+}
+
+static bool transport_connected = true;
+
+bool is_transport_connected(void) {
+    return transport_connected;
+}
+
+#ifdef ENCODER_ENABLE
+// Stand-ins for quantum/encoder.c: the slave's queue of steps, and the steps the master has handled
+static encoder_events_t slave_encoder_events;
+static bool             slave_encoder_drain;
+static std::vector<int> master_encoder_steps;
+
+bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
+    if (events->enqueued - events->dequeued >= MAX_QUEUED_ENCODER_EVENTS) {
+        return false;
+    }
+    events->queue[events->head] = (encoder_event_t){.index = index, .clockwise = clockwise ? 1 : 0};
+    events->head                = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    events->enqueued++;
+    return true;
+}
+
+bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
+    if (events->enqueued == events->dequeued) {
+        return false;
+    }
+    *index       = events->queue[events->tail].index;
+    *clockwise   = events->queue[events->tail].clockwise;
+    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    events->dequeued++;
+    return true;
+}
+
+bool encoder_queue_event(uint8_t index, bool clockwise) {
+    master_encoder_steps.push_back(clockwise ? index + 1 : -(index + 1));
+    return true;
+}
+
+void encoder_retrieve_events(encoder_events_t *events) {
+    memcpy(events, &slave_encoder_events, sizeof(slave_encoder_events));
+}
+
+void encoder_signal_queue_drain(void) {
+    slave_encoder_drain = true;
+}
+
+// The slave's encoder_task(): a drain asked for by the master, then any new step
+static void slave_encoder_task(int step) {
+    if (slave_encoder_drain) {
+        slave_encoder_drain           = false;
+        slave_encoder_events.tail     = slave_encoder_events.head;
+        slave_encoder_events.dequeued = slave_encoder_events.enqueued;
+    }
+    if (step != 0) {
+        encoder_queue_event_advanced(&slave_encoder_events, (step > 0 ? step : -step) - 1, step > 0);
+    }
+}
+#endif // ENCODER_ENABLE
+
+static void echo_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const uint8_t *in  = (const uint8_t *)initiator2target_buffer;
+    uint8_t       *out = (uint8_t *)target2initiator_buffer;
+    for (uint8_t i = 0; i < initiator2target_buffer_size && i < target2initiator_buffer_size; i++) {
+        out[i] = in[i] + 1;
+    }
+}
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+#if defined(SPLIT_TRANSPORT_BATCH)
+#    define TRANSPORT_NAME "split_transport_batch"
+#elif defined(SPLIT_TRANSPORT_PUSH) && defined(IDLE_SCHEDULER_ENABLE)
+#    define TRANSPORT_NAME "split_transport_push_idle"
+#elif defined(SPLIT_TRANSPORT_PUSH)
+#    define TRANSPORT_NAME "split_transport_push"
+#elif defined(SPLIT_TRANSPORT_MATRIX_DELTA)
+#    define TRANSPORT_NAME "split_transport_delta"
+#elif defined(IDLE_SCHEDULER_ENABLE)
+#    define TRANSPORT_NAME "split_transport_idle"
+#else
+#    define TRANSPORT_NAME "split_transport"
+#endif
+
+class SplitTransport : public ::testing::Test {
+   protected:
+    // Each half's view of the matrices
+    matrix_row_t             master_matrix[ROWS_PER_HAND]       = {0};
+    matrix_row_t             master_slave_matrix[ROWS_PER_HAND] = {0};
+    matrix_row_t             slave_matrix[ROWS_PER_HAND]        = {0};
+    matrix_row_t             slave_master_matrix[ROWS_PER_HAND] = {0};
+    serial_loopback_config_t config                             = SERIAL_LOOPBACK_DEFAULT_CONFIG;
+#ifdef SPLIT_TRANSPORT_PUSH
+    // Far enough apart that the master asks the slave for its status on every scan
+    uint32_t scan_interval_ms = SPLIT_TRANSPORT_POLL_INTERVAL;
+#else
+    uint32_t scan_interval_ms = 0;
+#endif
+
+    void SetUp() override {
+        set_time(1000);
+        transport_connected = true;
+#ifdef ENCODER_ENABLE
+        memset(&slave_encoder_events, 0, sizeof(slave_encoder_events));
+        slave_encoder_drain = false;
+        master_encoder_steps.clear();
+#endif
+        serial_loopback_init(&config);
+        // Start every test from a synced state
+        slave_scan();
+        master_scan();
+        serial_loopback_clear_stats();
+    }
+
+    void configure() {
+        serial_loopback_configure(&config);
+    }
+
+    void slave_scan() {
+        serial_loopback_enter_slave();
+        transport_slave(slave_master_matrix, slave_matrix);
+        serial_loopback_exit_slave();
+    }
+
+    bool master_scan() {
+        return transport_master(master_matrix, master_slave_matrix);
+    }
+
+    // One pass of both halves, the slave scanning its matrix before the master asks for it
+    bool scan() {
+        advance_time(scan_interval_ms);
+        slave_scan();
+        return master_scan();
+    }
+
+    // Bus time between a key changing on the slave and the master seeing it
+    uint64_t key_latency_us(unsigned *scans = nullptr) {
+        serial_loopback_clear_stats();
+        slave_matrix[0] ^= 1;
+        unsigned count = 0;
+        do {
+            scan();
+            count++;
+        } while (master_slave_matrix[0] != slave_matrix[0]);
+        if (scans) {
+            *scans = count;
+        }
+        return serial_loopback_get_stats().bus_time_us;
+    }
+};
+
+TEST_F(SplitTransport, slave_matrix_reaches_master) {
+    slave_matrix[0] = 0x0001;
+    slave_matrix[3] = 0x8000;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+
+    slave_matrix[0] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+}
+
+TEST_F(SplitTransport, master_matrix_is_mirrored_to_slave) {
+    master_matrix[1] = 0x0102;
+    EXPECT_TRUE(scan());
+    // Writes may take until the next exchange to be applied
+    EXPECT_TRUE(scan());
+    slave_scan();
+    EXPECT_EQ(memcmp(slave_master_matrix, master_matrix, sizeof(master_matrix)), 0);
+}
+
+#ifdef SPLIT_TRANSPORT_BATCH
+TEST_F(SplitTransport, one_exchange_per_scan) {
+    for (uint8_t i = 0; i < 10; i++) {
+        slave_matrix[0] ^= 1;
+        master_matrix[0] ^= 1;
+        serial_loopback_clear_stats();
+        EXPECT_TRUE(scan());
+        EXPECT_EQ(serial_loopback_get_stats().transactions, 1);
+        EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+    }
+}
+#else
+TEST_F(SplitTransport, unchanged_matrix_is_not_sent_again) {
+    slave_matrix[2] = 0x0404;
+    EXPECT_TRUE(scan());
+    uint32_t changed_bytes = serial_loopback_get_stats().bytes;
+
+    serial_loopback_clear_stats();
+    EXPECT_TRUE(scan());
+    EXPECT_LT(serial_loopback_get_stats().bytes, changed_bytes);
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+}
+#endif
+
+#ifdef SPLIT_TRANSPORT_PUSH
+TEST_F(SplitTransport, idle_slave_is_polled_less_often) {
+    scan_interval_ms = 1;
+    for (uint8_t i = 0; i < 100; i++) {
+        scan();
+    }
+    serial_loopback_clear_stats();
+    for (uint8_t i = 0; i < 100; i++) {
+        scan();
+    }
+    // One status poll per interval, plus the periodic forced resync in each direction
+    EXPECT_LE(serial_loopback_get_stats().transactions, 100 / SPLIT_TRANSPORT_POLL_INTERVAL + 4);
+}
+
+TEST_F(SplitTransport, missed_change_is_picked_up_by_forced_resync) {
+    scan_interval_ms = 1;
+    // 256 changes between polls wrap the status byte round to the value the master last saw
+    for (uint16_t i = 1; i <= 256; i++) {
+        slave_matrix[0] = i;
+        slave_scan();
+    }
+    for (uint8_t i = 0; i <= FORCED_SYNC_THROTTLE_MS; i++) {
+        scan();
+    }
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+}
+
+TEST_F(SplitTransport, idle_slave_change_is_seen_within_poll_interval) {
+    scan_interval_ms = 1;
+    for (uint8_t i = 0; i < 100; i++) {
+        scan();
+    }
+    unsigned scans;
+    key_latency_us(&scans);
+    EXPECT_LE(scans, SPLIT_TRANSPORT_POLL_INTERVAL + 1);
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+
+    // Changes coming in quick succession are picked up on the next scan
+    for (uint8_t i = 0; i < 10; i++) {
+        key_latency_us(&scans);
+        EXPECT_EQ(scans, 1);
+    }
+}
+#endif
+
+#ifdef IDLE_SCHEDULER_ENABLE
+// Both halves only run the passes the master's idle scheduler asks for
+TEST_F(SplitTransport, idle_master_wakes_when_slave_is_due) {
+    idle_scheduler_init();
+    unsigned passes    = 0;
+    uint32_t max_sleep = 0;
+    uint32_t end       = timer_read32() + 10 * IDLE_SCHEDULER_SCAN_INTERVAL;
+    while (timer_read32() < end) {
+        // Transfers take bus time, so the next pass may already be due
+        int32_t sleep = (int32_t)(idle_scheduler_next_wakeup() - timer_read32());
+        if (sleep > 0) {
+            max_sleep = sleep > (int32_t)max_sleep ? sleep : max_sleep;
+            advance_time(sleep);
+        }
+        idle_scheduler_begin_pass();
+        slave_scan();
+        master_scan();
+        passes++;
+    }
+#    ifdef SPLIT_TRANSPORT_PUSH
+    // The master sleeps until its next status poll
+    EXPECT_LE(max_sleep, SPLIT_TRANSPORT_POLL_INTERVAL);
+    EXPECT_LE(passes, 10 * IDLE_SCHEDULER_SCAN_INTERVAL / SPLIT_TRANSPORT_POLL_INTERVAL + 8);
+#    else
+    // Without push, the slave's keys are only seen by reading its matrix every millisecond
+    EXPECT_LE(max_sleep, 1);
+#    endif
+}
+#endif
+
+#ifdef ENCODER_ENABLE
+TEST_F(SplitTransport, encoder_steps_are_delivered_once) {
+    // Steps on consecutive scans, with gaps, in both directions on both of the slave's encoders
+    std::vector<int> steps = {3, 3, -3, 4, 0, 0, -4, 3, 0, 4, 4, 4, 0, 0, 0, -3, -3, 0, 4};
+    std::vector<int> sent;
+    for (int step : steps) {
+        slave_encoder_task(step);
+        if (step != 0) {
+            sent.push_back(step);
+        }
+        EXPECT_TRUE(scan());
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        slave_encoder_task(0);
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(master_encoder_steps, sent);
+}
+#endif
+
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+TEST_F(SplitTransport, matrix_is_rebuilt_from_events) {
+    // From a single key up to more changes than fit in one delta, which need a snapshot
+    for (uint8_t keys = 1; keys <= SPLIT_TRANSPORT_DELTA_EVENTS + 2; keys++) {
+        for (uint8_t i = 0; i < keys; i++) {
+            slave_matrix[(i * 3) % ROWS_PER_HAND] ^= (matrix_row_t)1 << ((i * 7 + keys) % MATRIX_COLS);
+        }
+        EXPECT_TRUE(scan());
+        EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0) << keys << " keys";
+    }
+}
+
+TEST_F(SplitTransport, missed_scans_are_caught_up) {
+    // Events the master has not read yet pile up on the slave
+    for (uint8_t i = 0; i < SPLIT_TRANSPORT_DELTA_EVENTS + 2; i++) {
+        slave_matrix[1] ^= (matrix_row_t)1 << i;
+        slave_scan();
+        if (i == SPLIT_TRANSPORT_DELTA_EVENTS / 2 - 1 || i == SPLIT_TRANSPORT_DELTA_EVENTS + 1) {
+            EXPECT_TRUE(master_scan());
+            EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0) << "after " << i + 1 << " events";
+        }
+    }
+}
+#endif
+
+TEST_F(SplitTransport, disconnected_slave_fails_without_retrying) {
+    config.disconnected = true;
+    configure();
+    transport_connected = false;
+
+    EXPECT_FALSE(master_scan());
+    serial_loopback_stats_t stats = serial_loopback_get_stats();
+    EXPECT_EQ(stats.transactions, 1);
+    EXPECT_EQ(stats.failed, 1);
+    EXPECT_EQ(stats.bus_time_us, config.timeout_us);
+}
+
+TEST_F(SplitTransport, dropped_transfers_are_retried) {
+    config.drop_ppm = 100000;
+    configure();
+
+    unsigned failed_scans = 0;
+    for (uint16_t i = 0; i < 200; i++) {
+        slave_matrix[i % ROWS_PER_HAND] = i;
+        if (!scan()) {
+            failed_scans++;
+        }
+    }
+    serial_loopback_stats_t stats = serial_loopback_get_stats();
+    EXPECT_GT(stats.drops, 0);
+    EXPECT_GT(stats.failed, 0);
+    // Retries hide most of the drops from the rest of the firmware
+    EXPECT_LT(failed_scans, stats.failed);
+
+    config.drop_ppm = 0;
+    configure();
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+}
+
+TEST_F(SplitTransport, corrupted_matrix_is_never_accepted) {
+    config.bit_error_ppm = 2000;
+    configure();
+
+    for (uint16_t i = 0; i < 500; i++) {
+        // Alternate between two patterns, any other state seen by the master came off a bad transfer
+        matrix_row_t pattern = (i & 1) ? 0x00FF : 0xF00F;
+        for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+            slave_matrix[row] = pattern;
+        }
+        scan();
+        for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+            matrix_row_t received = master_slave_matrix[row];
+            ASSERT_TRUE(received == 0x00FF || received == 0xF00F || received == 0) << "at " << i;
+        }
+    }
+    EXPECT_GT(serial_loopback_get_stats().bit_errors, 0);
+
+    config.bit_error_ppm = 0;
+    configure();
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+}
+
+TEST_F(SplitTransport, rpc_round_trip) {
+    transaction_register_rpc(USER_ECHO, echo_callback);
+
+    uint8_t request[4] = {1, 2, 3, 4};
+    uint8_t response[4];
+    EXPECT_TRUE(transaction_rpc_exec(USER_ECHO, sizeof(request), request, sizeof(response), response));
+    for (uint8_t i = 0; i < sizeof(request); i++) {
+        EXPECT_EQ(response[i], request[i] + 1);
+    }
+}
+
+TEST_F(SplitTransport, continuous_typing_stays_in_sync) {
+    // Both halves have a change to sync on every scan, at a 1ms scan rate
+    scan_interval_ms = 1;
+    for (unsigned i = 0; i < 1000; i++) {
+        slave_matrix[0] ^= 1;
+        master_matrix[1] ^= 1;
+        EXPECT_TRUE(scan());
+    }
+    // Writes may take until the next exchange to be applied
+    EXPECT_TRUE(scan());
+    slave_scan();
+    EXPECT_EQ(serial_loopback_get_stats().failed, 0);
+    EXPECT_EQ(memcmp(master_slave_matrix, slave_matrix, sizeof(slave_matrix)), 0);
+    EXPECT_EQ(memcmp(slave_master_matrix, master_matrix, sizeof(master_matrix)), 0);
+}
+
+// Throughput, retries and latency of the transport, from the loopback's counters
+TEST_F(SplitTransport, bus_load) {
+    const unsigned scans = 1000;
+    scan_interval_ms     = 1;
+
+    for (uint32_t drop_ppm : {0, 20000}) {
+        config.drop_ppm = drop_ppm;
+        configure();
+        serial_loopback_clear_stats();
+        for (unsigned i = 0; i < scans; i++) {
+            slave_matrix[0] ^= 1;
+            master_matrix[1] ^= 1;
+            scan();
+        }
+        serial_loopback_stats_t stats = serial_loopback_get_stats();
+        printf("[ COUNT    ] " TRANSPORT_NAME " typing, %5u ppm drops: %5.2f transactions/scan %6.1f bytes/scan %7.1f us bus time/scan %4u retries\n", (unsigned)drop_ppm, (double)stats.transactions / scans, (double)stats.bytes / scans, (double)stats.bus_time_us / scans, (unsigned)stats.failed);
+
+        if (drop_ppm) {
+            // Every retry is down to a dropped transfer
+            EXPECT_GT(stats.failed, 0);
+            EXPECT_LE(stats.failed, stats.drops);
+        } else {
+            EXPECT_EQ(stats.failed, 0);
+#ifdef SPLIT_TRANSPORT_BATCH
+            // Everything that changed goes out in one exchange per scan
+            EXPECT_LE(stats.transactions, scans + scans / 10);
+#endif
+        }
+    }
+
+    config.drop_ppm      = 0;
+    uint64_t last_latency = 0;
+    for (uint32_t turnaround_us : {20, 200}) {
+        config.turnaround_us = turnaround_us;
+        configure();
+        // Give the master time to back off, as it would between keypresses
+        for (uint8_t i = 0; i < 100; i++) {
+            scan();
+        }
+        unsigned scans_to_master;
+        uint64_t latency = key_latency_us(&scans_to_master);
+        printf("[ COUNT    ] " TRANSPORT_NAME " key latency with %3u us turnaround: %5u us bus time, %u scans\n", (unsigned)turnaround_us, (unsigned)latency, scans_to_master);
+#ifdef SPLIT_TRANSPORT_PUSH
+        // An idle slave is only asked for its status every poll interval
+        EXPECT_LE(scans_to_master, SPLIT_TRANSPORT_POLL_INTERVAL);
+#else
+        EXPECT_EQ(scans_to_master, 1u);
+#endif
+        EXPECT_GT(latency, last_latency);
+        last_latency = latency;
+    }
+}
+
+TEST_F(SplitTransport, benchmark) {
+    // Host time of idle scans, and scans where both halves have a change to sync, at a 1ms scan rate
+    scan_interval_ms = 1;
+    for (bool typing : {false, true}) {
+        const unsigned scans = 1000;
+        serial_loopback_clear_stats();
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < scans; i++) {
+            if (typing) {
+                slave_matrix[0] ^= 1;
+                master_matrix[0] ^= 1;
+            }
+            scan();
+        }
+        double                  ns    = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        serial_loopback_stats_t stats = serial_loopback_get_stats();
+        printf("[ BENCHMARK] " TRANSPORT_NAME " %-6s %5.2f transactions/scan %6.1f bytes/scan %7.1f us bus time/scan %6.0f ns host time/scan\n", typing ? "typing" : "idle", (double)stats.transactions / scans, (double)stats.bytes / scans, (double)stats.bus_time_us / scans, ns / scans);
+    }
+}
@@ -0,0 +1,9 @@
+TEST_LIST += \
+	split_transport \
+	split_transport_batch \
+	split_transport_push \
+	split_transport_idle \
+	split_transport_push_idle \
+	split_transport_delta \
+	split_transport_encoder \
+	split_transport_batch_encoder
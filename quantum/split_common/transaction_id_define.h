@@ -16,14 +16,30 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 enum serial_transaction_id {
 #ifdef USE_I2C
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXCHANGE_BATCH,
+#endif // SPLIT_TRANSPORT_BATCH
+
+#ifdef SPLIT_TRANSPORT_PUSH
+    GET_SLAVE_STATUS,
+#endif // SPLIT_TRANSPORT_PUSH
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+    GET_SLAVE_MATRIX_DELTA,
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
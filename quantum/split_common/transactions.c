@@ -30,6 +30,9 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -64,6 +67,9 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TRANSPORT_PUSH_PIN
+#    include "gpio.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -84,9 +90,18 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define trans_exchange_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
+#ifdef SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) batch_write(id, data, length)
+#    define transport_read(id, data, length) batch_read(id, data, length)
+#    define transport_exec(id) batch_write(id, NULL, 0)
+#else // SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#    define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
+#    define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#endif // SPLIT_TRANSPORT_BATCH
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -144,6 +159,203 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+////////////////////////////////////////////////////
+// Batched transport
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+typedef struct _split_batch_read_t {
+    int8_t checksum_id;
+    int8_t data_id;
+} split_batch_read_t;
+
+// Checksum/data pairs answered by every batch, the data only being sent when the master's copy is out of date
+static const split_batch_read_t batch_reads[] = {
+    {GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA},
+#    ifdef ENCODER_ENABLE
+    {GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA},
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    {GET_POINTING_CHECKSUM, GET_POINTING_DATA},
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+};
+
+#    define NUM_BATCH_READS (sizeof(batch_reads) / sizeof(batch_reads[0]))
+
+_Static_assert(sizeof(split_batch_request_t) <= UINT8_MAX && sizeof(split_batch_response_t) <= UINT8_MAX, "Split batch buffers too large");
+_Static_assert(NUM_BATCH_READS < SPLIT_TRANSPORT_BATCH_SIZE, "SPLIT_TRANSPORT_BATCH_SIZE too small");
+
+// Covers the length and data of a request or response
+#    define batch_checksum(frame) crc8(&(frame)->length, (frame)->length + 1)
+
+static bool     batch_active = false; // set while the master handlers run
+static uint32_t batch_served = 0;     // transactions answered by the last exchange
+static uint8_t  batch_records[SPLIT_TRANSPORT_BATCH_SIZE - NUM_BATCH_READS];
+static uint8_t  batch_records_length = 0;
+
+static uint8_t *batch_find_record(int8_t id) {
+    uint8_t i = 0;
+    while (i < batch_records_length) {
+        if (batch_records[i] == (uint8_t)id) {
+            return &batch_records[i];
+        }
+        i += 1 + split_transaction_table[batch_records[i]].initiator2target_buffer_size;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Queues a write until the next exchange with the slave. A queued write
+ * replaces any earlier one with the same ID that has not been sent yet.
+ */
+static bool batch_write(int8_t id, const void *data, uint16_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (!batch_active || length != trans->initiator2target_buffer_size) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+#    ifndef DISABLE_SYNC_TIMER
+    // The timer value is only valid at the time it is sent
+    if (id == PUT_SYNC_TIMER) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+#    endif // DISABLE_SYNC_TIMER
+#    ifdef ENCODER_ENABLE
+    // The slave has to drop the handled steps before it answers the next
+    // exchange, or the master reads them again
+    if (id == CMD_ENCODER_DRAIN) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+#    endif // ENCODER_ENABLE
+
+    uint8_t *record = batch_find_record(id);
+    if (!record) {
+        if (batch_records_length + 1 + length > sizeof(batch_records)) {
+            return transport_execute_transaction(id, data, length, NULL, 0);
+        }
+        record    = &batch_records[batch_records_length];
+        record[0] = id;
+        batch_records_length += 1 + length;
+    }
+    if (length > 0) {
+        memcpy(&record[1], data, length);
+        // Keep the local copy up to date, as a direct transaction would
+        memcpy(split_trans_initiator2target_buffer(trans), data, length);
+    }
+    return true;
+}
+
+static bool batch_read(int8_t id, void *data, uint16_t length) {
+    if (batch_active && (batch_served & (1UL << id))) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        memcpy(data, split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size < length ? trans->target2initiator_buffer_size : length);
+        return true;
+    }
+    return transport_execute_transaction(id, NULL, 0, data, length);
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_batch_request_t  request;
+    split_batch_response_t response;
+
+    batch_served = 0;
+
+    // Tell the slave what we already have, then send the writes queued since the last exchange
+    for (uint8_t i = 0; i < NUM_BATCH_READS; ++i) {
+        split_transaction_desc_t *data_trans = &split_transaction_table[batch_reads[i].data_id];
+        request.data[i]                      = crc8(split_trans_target2initiator_buffer(data_trans), data_trans->target2initiator_buffer_size);
+    }
+    memcpy(&request.data[NUM_BATCH_READS], batch_records, batch_records_length);
+    request.length   = NUM_BATCH_READS + batch_records_length;
+    request.checksum = batch_checksum(&request);
+
+    if (!transport_execute_transaction(EXCHANGE_BATCH, &request, offsetof(split_batch_request_t, data) + request.length, &response, sizeof(response))) {
+        return false;
+    }
+    if (response.length > sizeof(response.data) || batch_checksum(&response) != response.checksum) {
+        return false;
+    }
+
+    // The writes have been applied, keep them queued otherwise so that the next exchange retries them
+    batch_records_length = 0;
+
+    const uint8_t *cursor = response.data;
+    const uint8_t *end    = response.data + response.length;
+    for (uint8_t i = 0; i < NUM_BATCH_READS; ++i) {
+        split_transaction_desc_t *checksum_trans = &split_transaction_table[batch_reads[i].checksum_id];
+        split_transaction_desc_t *data_trans     = &split_transaction_table[batch_reads[i].data_id];
+        if (cursor + checksum_trans->target2initiator_buffer_size > end) {
+            return false;
+        }
+        bool changed = *cursor != request.data[i];
+        memcpy(split_trans_target2initiator_buffer(checksum_trans), cursor, checksum_trans->target2initiator_buffer_size);
+        cursor += checksum_trans->target2initiator_buffer_size;
+        batch_served |= 1UL << batch_reads[i].checksum_id;
+
+        if (changed) {
+            if (cursor + data_trans->target2initiator_buffer_size > end) {
+                return false;
+            }
+            memcpy(split_trans_target2initiator_buffer(data_trans), cursor, data_trans->target2initiator_buffer_size);
+            cursor += data_trans->target2initiator_buffer_size;
+            batch_served |= 1UL << batch_reads[i].data_id;
+        }
+    }
+    return true;
+}
+
+static void batch_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_batch_request_t  *request  = &split_shmem->batch.request;
+    split_batch_response_t *response = &split_shmem->batch.response;
+
+    response->length = 0;
+    if (request->length < NUM_BATCH_READS || request->length > sizeof(request->data) || batch_checksum(request) != request->checksum) {
+        // Make sure the master discards the response
+        response->checksum = ~batch_checksum(response);
+        return;
+    }
+
+    // Apply the writes as if each had been its own transaction
+    const uint8_t *record = &request->data[NUM_BATCH_READS];
+    const uint8_t *end    = request->data + request->length;
+    while (record < end && record[0] < NUM_TOTAL_TRANSACTIONS) {
+        split_transaction_desc_t *trans = &split_transaction_table[record[0]];
+        if (record + 1 + trans->initiator2target_buffer_size > end) {
+            break;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), &record[1], trans->initiator2target_buffer_size);
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+        record += 1 + trans->initiator2target_buffer_size;
+    }
+
+    // Answer every checksum, and the data the master does not have yet
+    uint8_t *cursor = response->data;
+    for (uint8_t i = 0; i < NUM_BATCH_READS; ++i) {
+        split_transaction_desc_t *checksum_trans = &split_transaction_table[batch_reads[i].checksum_id];
+        split_transaction_desc_t *data_trans     = &split_transaction_table[batch_reads[i].data_id];
+        memcpy(cursor, split_trans_target2initiator_buffer(checksum_trans), checksum_trans->target2initiator_buffer_size);
+        bool changed = *cursor != request->data[i];
+        cursor += checksum_trans->target2initiator_buffer_size;
+        if (changed) {
+            memcpy(cursor, split_trans_target2initiator_buffer(data_trans), data_trans->target2initiator_buffer_size);
+            cursor += data_trans->target2initiator_buffer_size;
+        }
+    }
+    response->length   = cursor - response->data;
+    response->checksum = batch_checksum(response);
+}
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [EXCHANGE_BATCH] = trans_exchange_initializer_cb(batch.request, batch.response, batch_handlers_slave_exchange),
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
@@ -175,15 +387,246 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Slave status
+
+#ifdef SPLIT_TRANSPORT_PUSH
+
+// Whether the handlers reading from the slave have to run this scan
+static bool slave_reads_pending = true;
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+// When the slave is next due to be polled, while it is idle
+static uint32_t slave_poll_due = 0;
+#    endif
+
+// A handler also reads once FORCED_SYNC_THROTTLE_MS has passed, in case a change was missed
+#    define slave_read_due(last_update) (slave_reads_pending || timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS)
+
+#    ifdef SPLIT_TRANSPORT_PUSH_PIN
+static void push_pin_init(void) {
+    static bool initialized = false;
+    if (!initialized) {
+        if (is_keyboard_master()) {
+            gpio_set_pin_input_high(SPLIT_TRANSPORT_PUSH_PIN);
+        } else {
+            gpio_set_pin_output(SPLIT_TRANSPORT_PUSH_PIN);
+            gpio_write_pin_high(SPLIT_TRANSPORT_PUSH_PIN);
+        }
+        initialized = true;
+    }
+}
+
+#        define push_pin_asserted() (push_pin_init(), !gpio_read_pin(SPLIT_TRANSPORT_PUSH_PIN))
+#        define push_pin_assert() (push_pin_init(), gpio_write_pin_low(SPLIT_TRANSPORT_PUSH_PIN))
+#        define push_pin_release() gpio_write_pin_high(SPLIT_TRANSPORT_PUSH_PIN)
+#    else // SPLIT_TRANSPORT_PUSH_PIN
+#        define push_pin_asserted() false
+#        define push_pin_assert()
+#        define push_pin_release()
+#    endif // SPLIT_TRANSPORT_PUSH_PIN
+
+static bool slave_status_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t  last_status   = 0;
+    static uint32_t last_poll     = 0;
+    static uint16_t poll_interval = 0;
+
+    // Reads that failed last scan are retried without asking first
+    if (slave_reads_pending) {
+        return true;
+    }
+    // Back off while the slave is idle, unless it raises the push pin
+    if (!push_pin_asserted() && timer_elapsed32(last_poll) < poll_interval) {
+        return true;
+    }
+
+    uint8_t status;
+    if (!transport_read(GET_SLAVE_STATUS, &status, sizeof(status))) {
+        slave_reads_pending = true;
+        return false;
+    }
+    last_poll = timer_read32();
+
+    if (status == last_status) {
+        // Double the interval on every idle poll, up to SPLIT_TRANSPORT_POLL_INTERVAL
+        poll_interval = poll_interval ? poll_interval * 2 : 1;
+        if (poll_interval > SPLIT_TRANSPORT_POLL_INTERVAL) {
+            poll_interval = SPLIT_TRANSPORT_POLL_INTERVAL;
+        }
+#    ifdef IDLE_SCHEDULER_ENABLE
+        slave_poll_due = last_poll + poll_interval;
+#    endif
+        return true;
+    }
+
+    last_status         = status;
+    poll_interval       = 0;
+    slave_reads_pending = true;
+    return true;
+}
+
+static void slave_status_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // The checksums of everything the master reads, as of the last scan
+    static uint8_t last_checksums[3] = {0};
+    uint8_t        checksums[3]      = {split_shmem->smatrix.checksum};
+#    ifdef ENCODER_ENABLE
+    checksums[1] = split_shmem->encoders.checksum;
+#    endif // ENCODER_ENABLE
+    bool changed = false;
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    checksums[2] = split_shmem->pointing.checksum;
+    // A moving pointer sends the same report over and over, each of which has to reach the master
+    report_mouse_t *report = &split_shmem->pointing.report;
+    changed                = report->x || report->y || report->h || report->v;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+    if (changed || memcmp(checksums, last_checksums, sizeof(checksums)) != 0) {
+        memcpy(last_checksums, checksums, sizeof(checksums));
+        split_shmem->slave_status++;
+        push_pin_assert();
+    }
+}
+
+static void slave_status_handlers_slave_polled(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    push_pin_release();
+}
+
+#    define TRANSACTIONS_SLAVE_STATUS_MASTER() TRANSACTION_HANDLER_MASTER(slave_status)
+#    define TRANSACTIONS_SLAVE_STATUS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_status)
+#    define TRANSACTIONS_SLAVE_STATUS_REGISTRATIONS [GET_SLAVE_STATUS] = trans_target2initiator_initializer_cb(slave_status, slave_status_handlers_slave_polled),
+#    define TRANSACTIONS_SLAVE_STATUS_SYNCED() slave_reads_pending = false
+
+#else // SPLIT_TRANSPORT_PUSH
+
+#    define slave_read_due(last_update) true
+
+#    define TRANSACTIONS_SLAVE_STATUS_MASTER()
+#    define TRANSACTIONS_SLAVE_STATUS_SLAVE()
+#    define TRANSACTIONS_SLAVE_STATUS_REGISTRATIONS
+#    define TRANSACTIONS_SLAVE_STATUS_SYNCED()
+
+#endif // SPLIT_TRANSPORT_PUSH
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+
+_Static_assert(SPLIT_TRANSPORT_DELTA_EVENTS <= 128 && (SPLIT_TRANSPORT_DELTA_EVENTS & (SPLIT_TRANSPORT_DELTA_EVENTS - 1)) == 0, "SPLIT_TRANSPORT_DELTA_EVENTS must be a power of two, no larger than 128");
+_Static_assert(MATRIX_COLS <= 128, "SPLIT_TRANSPORT_MATRIX_DELTA supports up to 128 columns");
+
+#    define MATRIX_EVENT_PRESSED 0x80
+
+// The last events seen by the slave, indexed by their sequence number
+static split_matrix_event_t matrix_events[SPLIT_TRANSPORT_DELTA_EVENTS];
+static uint8_t              matrix_event_sequence = 0;
+
+static void record_slave_matrix_events(const matrix_row_t *previous, const matrix_row_t *current) {
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        matrix_row_t changes = previous[row] ^ current[row];
+        for (uint8_t col = 0; changes; col++, changes >>= 1) {
+            if (changes & 1) {
+                split_matrix_event_t *event = &matrix_events[++matrix_event_sequence % SPLIT_TRANSPORT_DELTA_EVENTS];
+                event->row                  = row;
+                event->col                  = col | ((current[row] >> col) & 1 ? MATRIX_EVENT_PRESSED : 0);
+            }
+        }
+    }
+}
+
+static void slave_matrix_delta_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_slave_matrix_delta_t *delta = &split_shmem->smatrix_delta.delta;
+    uint8_t                     acked = split_shmem->smatrix_delta.acked;
+    uint8_t                     count = matrix_event_sequence - acked;
+
+    delta->matrix_checksum = split_shmem->smatrix.checksum;
+    delta->sequence        = matrix_event_sequence;
+    delta->count           = count;
+    if (count <= SPLIT_TRANSPORT_DELTA_EVENTS) {
+        for (uint8_t i = 0; i < count; i++) {
+            delta->events[i] = matrix_events[(uint8_t)(acked + 1 + i) % SPLIT_TRANSPORT_DELTA_EVENTS];
+        }
+    }
+    delta->checksum = crc8(&delta->matrix_checksum, sizeof(*delta) - offsetof(split_slave_matrix_delta_t, matrix_checksum));
+}
+
+/**
+ * @brief Applies the events of a delta to the matrix.
+ *
+ * @return false if the events cannot be applied, and a snapshot is needed.
+ */
+static bool apply_slave_matrix_delta(const split_slave_matrix_delta_t *delta, uint8_t sequence, matrix_row_t *matrix) {
+    if (delta->count > SPLIT_TRANSPORT_DELTA_EVENTS || (uint8_t)(delta->sequence - delta->count) != sequence) {
+        return false;
+    }
+    for (uint8_t i = 0; i < delta->count; i++) {
+        uint8_t row = delta->events[i].row;
+        uint8_t col = delta->events[i].col & ~MATRIX_EVENT_PRESSED;
+        if (row >= (MATRIX_ROWS) / 2 || col >= MATRIX_COLS) {
+            return false;
+        }
+        if (delta->events[i].col & MATRIX_EVENT_PRESSED) {
+            matrix[row] |= MATRIX_ROW_SHIFTER << col;
+        } else {
+            matrix[row] &= ~(MATRIX_ROW_SHIFTER << col);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Same as read_if_checksum_mismatch() for the slave matrix, except the
+ * changes are read as a list of key events, falling back to reading the
+ * whole matrix if the master missed any.
+ */
+static bool read_slave_matrix_delta(uint32_t *last_update, matrix_row_t *destination) {
+    static uint8_t             sequence = 0; // sequence number of the last event applied
+    split_slave_matrix_delta_t delta;
+    uint8_t                    curr_checksum;
+    const size_t               length = sizeof(split_shmem->smatrix.matrix);
+
+    bool okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    memcpy(destination, split_shmem->smatrix.matrix, length);
+    if (!okay || (timer_elapsed32(*last_update) < FORCED_SYNC_THROTTLE_MS && curr_checksum == crc8(destination, length))) {
+        return okay;
+    }
+
+    okay = transport_execute_transaction(GET_SLAVE_MATRIX_DELTA, &sequence, sizeof(sequence), &delta, sizeof(delta));
+    okay = okay && delta.checksum == crc8(&delta.matrix_checksum, sizeof(delta) - offsetof(split_slave_matrix_delta_t, matrix_checksum));
+    if (!okay) {
+        return false;
+    }
+
+    if (!apply_slave_matrix_delta(&delta, sequence, destination) || crc8(destination, length) != delta.matrix_checksum) {
+        // Missed events, or too many of them, so start over from a snapshot
+        okay = transport_read(GET_SLAVE_MATRIX_DATA, destination, length);
+        okay = okay && crc8(destination, length) == delta.matrix_checksum;
+    }
+    if (okay) {
+        sequence     = delta.sequence;
+        *last_update = timer_read32();
+        memcpy(split_shmem->smatrix.matrix, destination, length);
+    }
+    return okay;
+}
+
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
+    if (!slave_read_due(last_update)) {
+        memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+        return true;
+    }
+
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+    bool okay = read_slave_matrix_delta(&last_update, temp_matrix);
+#else
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -194,16 +637,26 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+    record_slave_matrix_events(split_shmem->smatrix.matrix, slave_matrix);
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+#    define TRANSACTIONS_SLAVE_MATRIX_DELTA_REGISTRATIONS [GET_SLAVE_MATRIX_DELTA] = trans_exchange_initializer_cb(smatrix_delta.acked, smatrix_delta.delta, slave_matrix_delta_callback),
+#else // SPLIT_TRANSPORT_MATRIX_DELTA
+#    define TRANSACTIONS_SLAVE_MATRIX_DELTA_REGISTRATIONS
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
+
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    TRANSACTIONS_SLAVE_MATRIX_DELTA_REGISTRATIONS
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -243,6 +696,10 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
     static uint8_t   last_checksum = 0;
     encoder_events_t temp_events;
 
+    if (!slave_read_due(last_update)) {
+        return true;
+    }
+
     bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
         if (last_checksum != split_shmem->encoders.checksum) {
@@ -720,8 +1177,11 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint16_t last_cpi        = 0;
     report_mouse_t  temp_state;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    bool            okay = true;
+    if (slave_read_due(last_update)) {
+        okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
+        if (okay) pointing_device_set_shared_report(temp_state);
+    }
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -925,6 +1385,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BATCH_REGISTRATIONS
+    TRANSACTIONS_SLAVE_STATUS_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -954,7 +1416,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_SLAVE_STATUS_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -974,9 +1437,42 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_SLAVE_STATUS_SYNCED();
     return true;
 }
 
+#ifdef IDLE_SCHEDULER_ENABLE
+/** \brief Requests the next pass of the main loop for when the slave is next due to be read. */
+static void transactions_request_wake(void) {
+#    ifdef SPLIT_TRANSPORT_PUSH
+    if (slave_reads_pending) {
+        idle_scheduler_wake_in(1);
+    } else {
+        idle_scheduler_wake_at(slave_poll_due);
+    }
+#    else
+    // The slave's keys are only seen when its matrix is read, which happens on every pass
+    idle_scheduler_wake_in(1);
+#    endif
+}
+#endif
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Exchange with the slave once, then let the handlers work from its response and queue their writes
+    TRANSACTIONS_BATCH_MASTER();
+    batch_active = true;
+    bool okay    = transactions_master_handlers(master_matrix, slave_matrix);
+    batch_active = false;
+#else  // SPLIT_TRANSPORT_BATCH
+    bool okay = transactions_master_handlers(master_matrix, slave_matrix);
+#endif // SPLIT_TRANSPORT_BATCH
+#ifdef IDLE_SCHEDULER_ENABLE
+    transactions_request_wake();
+#endif
+    return okay;
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
@@ -997,6 +1493,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_SLAVE_STATUS_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
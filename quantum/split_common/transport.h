@@ -31,6 +31,30 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#    define SPLIT_TRANSPORT_BATCH_SIZE 32
+#endif // SPLIT_TRANSPORT_BATCH_SIZE
+
+#ifndef SPLIT_TRANSPORT_POLL_INTERVAL
+#    ifdef SPLIT_TRANSPORT_PUSH_PIN
+#        define SPLIT_TRANSPORT_POLL_INTERVAL 100
+#    else
+#        define SPLIT_TRANSPORT_POLL_INTERVAL 0
+#    endif
+#endif // SPLIT_TRANSPORT_POLL_INTERVAL
+
+#if defined(SPLIT_TRANSPORT_PUSH) && defined(SPLIT_TRANSPORT_BATCH)
+#    error "SPLIT_TRANSPORT_PUSH and SPLIT_TRANSPORT_BATCH cannot be used together"
+#endif
+
+#ifndef SPLIT_TRANSPORT_DELTA_EVENTS
+#    define SPLIT_TRANSPORT_DELTA_EVENTS 4
+#endif // SPLIT_TRANSPORT_DELTA_EVENTS
+
+#if defined(SPLIT_TRANSPORT_MATRIX_DELTA) && defined(SPLIT_TRANSPORT_BATCH)
+#    error "SPLIT_TRANSPORT_MATRIX_DELTA and SPLIT_TRANSPORT_BATCH cannot be used together"
+#endif
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -57,6 +81,26 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+typedef struct _split_matrix_event_t {
+    uint8_t row;
+    uint8_t col; // with the top bit set if the key was pressed
+} split_matrix_event_t;
+
+typedef struct _split_slave_matrix_delta_t {
+    uint8_t              checksum;        // crc8 of the rest of the struct
+    uint8_t              matrix_checksum; // crc8 of the slave matrix, once the events are applied
+    uint8_t              sequence;        // sequence number of the last event
+    uint8_t              count;           // number of events, more than SPLIT_TRANSPORT_DELTA_EVENTS if the master fell too far behind
+    split_matrix_event_t events[SPLIT_TRANSPORT_DELTA_EVENTS];
+} split_slave_matrix_delta_t;
+
+typedef struct _split_slave_matrix_delta_sync_t {
+    uint8_t                    acked; // sequence number of the last event the master has
+    split_slave_matrix_delta_t delta;
+} split_slave_matrix_delta_sync_t;
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -147,13 +191,56 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+// Everything the slave may have to send back in a single batch
+typedef struct _split_batch_reads_t {
+    split_slave_matrix_sync_t smatrix;
+#    ifdef ENCODER_ENABLE
+    split_slave_encoder_sync_t encoders;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    uint8_t        pointing_checksum;
+    report_mouse_t pointing_report;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_batch_reads_t;
+
+typedef struct _split_batch_request_t {
+    uint8_t checksum; // crc8 of length and data
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSPORT_BATCH_SIZE];
+} split_batch_request_t;
+
+typedef struct _split_batch_response_t {
+    uint8_t checksum; // crc8 of length and data
+    uint8_t length;
+    uint8_t data[sizeof(split_batch_reads_t)];
+} split_batch_response_t;
+
+typedef struct _split_batch_sync_t {
+    split_batch_request_t  request;
+    split_batch_response_t response;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSPORT_MATRIX_DELTA
+    split_slave_matrix_delta_sync_t smatrix_delta;
+#endif // SPLIT_TRANSPORT_MATRIX_DELTA
+
+#ifdef SPLIT_TRANSPORT_PUSH
+    uint8_t slave_status; // bumped by the slave whenever it has new data for the master
+#endif // SPLIT_TRANSPORT_PUSH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -32,6 +32,13 @@
 #    include "audio.h"
 #endif
 
+#ifdef UNICODE_ASYNC
+#    include "timer.h"
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        include "idle_scheduler.h"
+#    endif
+#endif
+
 #if defined(UNICODE_ENABLE) + defined(UNICODEMAP_ENABLE) + defined(UCIS_ENABLE) > 1
 #    error "Cannot enable more than one Unicode method (UNICODE, UNICODEMAP, UCIS) at the same time"
 #endif
@@ -67,6 +74,45 @@ unicode_config_t unicode_config;
 uint8_t          unicode_saved_mods;
 led_t            unicode_saved_led_state;
 
+#ifdef UNICODE_ASYNC
+// Size of the queue of pending input steps, in bytes
+#    ifndef UNICODE_ASYNC_BUFFER_SIZE
+#        define UNICODE_ASYNC_BUFFER_SIZE 32
+#    endif
+
+// Most steps a single code point can need: the start of input (with a delay on
+// either side of Windows' KP_PLUS), two surrogates of four digits, and the finish
+#    define UNICODE_ASYNC_MAX_STEPS 13
+
+// Number of key events that can be held back while a code point is being typed
+#    ifndef UNICODE_ASYNC_HELD_EVENTS
+#        define UNICODE_ASYNC_HELD_EVENTS 8
+#    endif
+
+_Static_assert(UNICODE_ASYNC_BUFFER_SIZE >= UNICODE_ASYNC_MAX_STEPS && UNICODE_ASYNC_BUFFER_SIZE <= 255, "UNICODE_ASYNC_BUFFER_SIZE must be between 13 and 255");
+_Static_assert(UNICODE_ASYNC_HELD_EVENTS >= 1 && UNICODE_ASYNC_HELD_EVENTS <= 255, "UNICODE_ASYNC_HELD_EVENTS must be between 1 and 255");
+
+// Steps of the queue; values below 0x10 are hex digits
+enum unicode_async_step {
+    UNICODE_STEP_START = 0x10,
+    UNICODE_STEP_WINDOWS_PLUS,
+    UNICODE_STEP_DELAY,
+    UNICODE_STEP_FINISH,
+};
+
+static uint8_t     unicode_steps[UNICODE_ASYNC_BUFFER_SIZE];
+static uint8_t     unicode_step_head  = 0;
+static uint8_t     unicode_step_count = 0;
+static bool        unicode_waiting    = false;
+static bool        unicode_in_input   = false;
+static uint32_t    unicode_wait_start = 0;
+static const char *unicode_string     = NULL;
+
+static keyevent_t unicode_held_events[UNICODE_ASYNC_HELD_EVENTS];
+static uint8_t    unicode_held_head  = 0;
+static uint8_t    unicode_held_count = 0;
+#endif
+
 #if UNICODE_SELECTED_MODES != -1
 static uint8_t selected[]     = {UNICODE_SELECTED_MODES};
 static int8_t  selected_count = ARRAY_SIZE(selected);
@@ -208,7 +254,8 @@ void unicode_input_mode_step_reverse(void) {
     cycle_unicode_input_mode(-1);
 }
 
-__attribute__((weak)) void unicode_input_start(void) {
+/** \brief Everything unicode_input_start() does before its first delay. */
+static void unicode_input_begin(void) {
     unicode_saved_led_state = host_keyboard_led_state();
 
     // Note the order matters here!
@@ -236,8 +283,6 @@ __attribute__((weak)) void unicode_input_start(void) {
                 tap_code(KC_NUM_LOCK);
             }
             register_code(KC_LEFT_ALT);
-            wait_ms(UNICODE_TYPE_DELAY);
-            tap_code(KC_KP_PLUS);
             break;
         case UNICODE_MODE_WINCOMPOSE:
             tap_code(UNICODE_KEY_WINC);
@@ -250,7 +295,14 @@ __attribute__((weak)) void unicode_input_start(void) {
             tap_code16(KC_ENTER);
             break;
     }
+}
 
+__attribute__((weak)) void unicode_input_start(void) {
+    unicode_input_begin();
+    if (unicode_config.input_mode == UNICODE_MODE_WINDOWS) {
+        wait_ms(UNICODE_TYPE_DELAY);
+        tap_code(KC_KP_PLUS);
+    }
     wait_ms(UNICODE_TYPE_DELAY);
 }
 
@@ -279,7 +331,7 @@ __attribute__((weak)) void unicode_input_finish(void) {
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    set_mods(get_mods() | unicode_saved_mods); // Reregister previously set mods, keeping any set since
 }
 
 __attribute__((weak)) void unicode_input_cancel(void) {
@@ -307,7 +359,7 @@ __attribute__((weak)) void unicode_input_cancel(void) {
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    set_mods(get_mods() | unicode_saved_mods); // Reregister previously set mods, keeping any set since
 }
 
 // clang-format off
@@ -332,7 +384,8 @@ void register_hex(uint16_t hex) {
     }
 }
 
-void register_hex32(uint32_t hex) {
+/** \brief Passes the digits register_hex32() would type for `hex` to `emit`. */
+static void unicode_hex32_digits(uint32_t hex, void (*emit)(uint8_t digit)) {
     bool first_digit        = true;
     bool needs_leading_zero = (unicode_config.input_mode == UNICODE_MODE_WINCOMPOSE);
     for (int i = 7; i >= 0; i--) {
@@ -342,7 +395,7 @@ void register_hex32(uint32_t hex) {
         // If we're still searching for the first digit, and found one
         // that needs a leading zero sent out, send the zero.
         if (first_digit && needs_leading_zero && digit > 9) {
-            send_nibble_wrapper(0);
+            emit(0);
         }
 
         // Always send digits (including zero) if we're down to the last
@@ -351,13 +404,181 @@ void register_hex32(uint32_t hex) {
 
         // If we've found a digit worth transmitting, do so.
         if (digit != 0 || !first_digit || must_send) {
-            send_nibble_wrapper(digit);
+            emit(digit);
             first_digit = false;
         }
     }
 }
 
+void register_hex32(uint32_t hex) {
+    unicode_hex32_digits(hex, send_nibble_wrapper);
+}
+
+#ifdef UNICODE_ASYNC
+/* Queued input
+ *
+ * Each code point is expanded up front into a short run of one-byte steps: the
+ * start of the input sequence, the hex digits, and the finish, with a step for
+ * each UNICODE_TYPE_DELAY in between. unicode_task() then works through them
+ * from keyboard_task(), handing back to the main loop whenever it reaches a
+ * delay or the end of a code point instead of calling wait_ms().
+ *
+ * send_unicode_string() keeps a pointer to its string, and only expands the
+ * next code point once there is room for it.
+ */
+
+static void unicode_push_step(uint8_t step) {
+    unicode_steps[(unicode_step_head + unicode_step_count) % UNICODE_ASYNC_BUFFER_SIZE] = step;
+    unicode_step_count++;
+}
+
+static bool unicode_has_room(void) {
+    return UNICODE_ASYNC_BUFFER_SIZE - unicode_step_count >= UNICODE_ASYNC_MAX_STEPS;
+}
+
+static void unicode_queue_code_point(uint32_t code_point) {
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
+        // Code point out of range, do nothing
+        return;
+    }
+
+    unicode_push_step(UNICODE_STEP_START);
+    if (unicode_config.input_mode == UNICODE_MODE_WINDOWS) {
+        unicode_push_step(UNICODE_STEP_DELAY);
+        unicode_push_step(UNICODE_STEP_WINDOWS_PLUS);
+    }
+    unicode_push_step(UNICODE_STEP_DELAY);
+    if (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_MACOS) {
+        // Convert code point to UTF-16 surrogate pair on macOS
+        code_point -= 0x10000;
+        uint32_t lo = code_point & 0x3FF, hi = (code_point & 0xFFC00) >> 10;
+        unicode_hex32_digits(hi + 0xD800, unicode_push_step);
+        unicode_hex32_digits(lo + 0xDC00, unicode_push_step);
+    } else {
+        unicode_hex32_digits(code_point, unicode_push_step);
+    }
+    unicode_push_step(UNICODE_STEP_FINISH);
+}
+
+/** \brief Expands as much of the pending string as there is room for. */
+static void unicode_fill_steps(void) {
+    while (unicode_string && unicode_has_room()) {
+        int32_t code_point = 0;
+        unicode_string     = decode_utf8(unicode_string, &code_point);
+        if (code_point >= 0) {
+            unicode_queue_code_point(code_point);
+        }
+        if (!*unicode_string) {
+            unicode_string = NULL;
+        }
+    }
+}
+
+void unicode_task(void) {
+    if (unicode_waiting) {
+        if (timer_elapsed32(unicode_wait_start) < UNICODE_TYPE_DELAY) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+            idle_scheduler_wake_at(unicode_wait_start + UNICODE_TYPE_DELAY);
+#    endif
+            return;
+        }
+        unicode_waiting = false;
+    }
+
+    while (unicode_step_count) {
+        uint8_t step      = unicode_steps[unicode_step_head];
+        unicode_step_head = (unicode_step_head + 1) % UNICODE_ASYNC_BUFFER_SIZE;
+        unicode_step_count--;
+
+        if (step < UNICODE_STEP_START) {
+            send_nibble_wrapper(step);
+        } else if (step == UNICODE_STEP_START) {
+            unicode_in_input = true;
+            unicode_input_begin();
+        } else if (step == UNICODE_STEP_WINDOWS_PLUS) {
+            tap_code(KC_KP_PLUS);
+        } else if (step == UNICODE_STEP_DELAY) {
+            unicode_waiting    = true;
+            unicode_wait_start = timer_read32();
+            break;
+        } else {
+            unicode_input_finish();
+            unicode_in_input = false;
+            break;
+        }
+    }
+
+    unicode_fill_steps();
+
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (unicode_waiting) {
+        idle_scheduler_wake_at(unicode_wait_start + UNICODE_TYPE_DELAY);
+    } else if (unicode_step_count || unicode_held_count) {
+        // Either the next code point, or key events held back by the last one
+        idle_scheduler_wake_in(0);
+    }
+#    endif
+}
+
+/** \brief Runs the queue in place, waiting out its delays, until `done` returns true. */
+static void unicode_run_until(bool (*done)(void)) {
+    while (!done()) {
+        if (unicode_waiting) {
+            uint32_t elapsed = timer_elapsed32(unicode_wait_start);
+            if (elapsed < UNICODE_TYPE_DELAY) {
+                wait_ms(UNICODE_TYPE_DELAY - elapsed);
+            }
+        }
+        unicode_task();
+    }
+}
+
+static bool unicode_can_queue(void) {
+    return !unicode_string && unicode_has_room();
+}
+
+bool unicode_busy(void) {
+    return unicode_step_count || unicode_string || unicode_waiting;
+}
+
+bool unicode_holds_input(void) {
+    return unicode_in_input;
+}
+
+bool unicode_hold_key_event(keyevent_t event) {
+    if (unicode_held_count == UNICODE_ASYNC_HELD_EVENTS) {
+        return false;
+    }
+    unicode_held_events[(unicode_held_head + unicode_held_count) % UNICODE_ASYNC_HELD_EVENTS] = event;
+    unicode_held_count++;
+    return true;
+}
+
+bool unicode_release_key_event(keyevent_t *event) {
+    if (unicode_in_input || !unicode_held_count) {
+        return false;
+    }
+    *event            = unicode_held_events[unicode_held_head];
+    unicode_held_head = (unicode_held_head + 1) % UNICODE_ASYNC_HELD_EVENTS;
+    unicode_held_count--;
+    return true;
+}
+
+static bool unicode_idle(void) {
+    return !unicode_busy();
+}
+
+void unicode_flush(void) {
+    unicode_run_until(unicode_idle);
+}
+#endif
+
 void register_unicode(uint32_t code_point) {
+#ifdef UNICODE_ASYNC
+    // Wait for room only if the queue is full, typing anything already queued first
+    unicode_run_until(unicode_can_queue);
+    unicode_queue_code_point(code_point);
+#else
     if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
         // Code point out of range, do nothing
         return;
@@ -374,6 +595,7 @@ void register_unicode(uint32_t code_point) {
         register_hex32(code_point);
     }
     unicode_input_finish();
+#endif
 }
 
 void send_unicode_string(const char *str) {
@@ -381,6 +603,13 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+#ifdef UNICODE_ASYNC
+    if (*str) {
+        unicode_run_until(unicode_can_queue);
+        unicode_string = str;
+        unicode_fill_steps();
+    }
+#else
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -389,4 +618,5 @@ void send_unicode_string(const char *str) {
             register_unicode(code_point);
         }
     }
+#endif
 }
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "unicode_keycodes.h"
+#include "keyboard.h"
 
 /**
  * \file
@@ -131,4 +133,42 @@ void register_unicode(uint32_t code_point);
  */
 void send_unicode_string(const char *str);
 
+#if defined(UNICODE_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Type out queued Unicode input, handing back to the main loop at each delay. Called from `keyboard_task()`.
+ */
+void unicode_task(void);
+
+/**
+ * \brief Return whether any queued Unicode input is still being typed.
+ */
+bool unicode_busy(void);
+
+/**
+ * \brief Return whether a code point is partway through being typed.
+ *
+ * Key events are held back with `unicode_hold_key_event()` while this is true, so that they land between code points.
+ */
+bool unicode_holds_input(void);
+
+/**
+ * \brief Hold back a key event until the code point being typed is finished.
+ *
+ * \return false if there is no room left to hold it.
+ */
+bool unicode_hold_key_event(keyevent_t event);
+
+/**
+ * \brief Take the oldest held key event, once no code point is being typed.
+ *
+ * \return false if there is no event to release yet.
+ */
+bool unicode_release_key_event(keyevent_t *event);
+
+/**
+ * \brief Type out all queued Unicode input before returning.
+ */
+void unicode_flush(void);
+#endif
+
 /** \} */
@@ -20,15 +20,17 @@ void MockBackingStore::reset_instance() {
 
     backing_init_invoke_count   = 0;
     backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
-
-    init_success_callback   = [](std::uint64_t) { return true; };
-    erase_success_callback  = [](std::uint64_t) { return true; };
-    unlock_success_callback = [](std::uint64_t) { return true; };
-    write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
-    lock_success_callback   = [](std::uint64_t) { return true; };
+    backing_erase_invoke_count       = 0;
+    backing_erase_range_invoke_count = 0;
+    backing_write_invoke_count       = 0;
+    backing_lock_invoke_count        = 0;
+
+    init_success_callback        = [](std::uint64_t) { return true; };
+    erase_success_callback       = [](std::uint64_t) { return true; };
+    erase_range_success_callback = [](std::uint64_t, std::uint32_t) { return true; };
+    unlock_success_callback      = [](std::uint64_t) { return true; };
+    write_success_callback       = [](std::uint64_t, std::uint32_t) { return true; };
+    lock_success_callback        = [](std::uint64_t) { return true; };
 
     write_log.clear();
 }
@@ -75,6 +77,30 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_range(uint32_t address, uint32_t length) {
+    ++backing_erase_range_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0 && length % BACKING_STORE_WRITE_SIZE == 0) << "Supplied range was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Range would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Erase each slot in the range
+    for (std::uint32_t offset = 0; offset < length; offset += BACKING_STORE_WRITE_SIZE) {
+        // Drop out of erase early with failure if we need to
+        if (erase_range_success_callback && !erase_range_success_callback(backing_erase_range_invoke_count, address + offset)) {
+            append_log(address, length, true);
+            return false;
+        }
+
+        backing_storage[(address + offset) / BACKING_STORE_WRITE_SIZE].erase();
+    }
+
+    // Keep track of the erase in the write log so that we can verify during tests
+    append_log(address, length, true);
+
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -141,6 +167,10 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -63,9 +63,11 @@ class MockBackingStoreElement {
 struct MockBackingStoreLogEntry {
     MockBackingStoreLogEntry(uint32_t address, backing_store_int_t value) : address(address), value(value), erased(false) {}
     MockBackingStoreLogEntry(bool erased) : address(0), value(0), erased(erased) {}
+    MockBackingStoreLogEntry(uint32_t address, uint32_t length, bool erased) : address(address), value(0), length(length), erased(erased) {}
     uint32_t            address = 0;     // The address of the operation
     backing_store_int_t value   = 0;     // The value of the operation
-    bool                erased  = false; // Whether the entire backing store was erased
+    uint32_t            length  = 0;     // The length of a ranged erase, 0 if the entire backing store was erased
+    bool                erased  = false; // Whether the entire backing store, or the range, was erased
 };
 
 class MockBackingStore {
@@ -94,6 +96,7 @@ class MockBackingStore {
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_range_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
 
@@ -101,6 +104,8 @@ class MockBackingStore {
     std::function<bool(std::uint64_t)> init_success_callback;
     // Whether erase should succeed
     std::function<bool(std::uint64_t)> erase_success_callback;
+    // Whether ranged erases should succeed
+    std::function<bool(std::uint64_t, std::uint32_t)> erase_range_success_callback;
     // Whether unlocks should succeed
     std::function<bool(std::uint64_t)> unlock_success_callback;
     // Whether writes should succeed
@@ -141,6 +146,9 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_range_invoke_count() const {
+        return backing_erase_range_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
@@ -159,6 +167,7 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::uint32_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
@@ -170,6 +179,9 @@ class MockBackingStore {
     void set_erase_callback(std::function<bool(std::uint64_t)> callback) {
         erase_success_callback = callback;
     }
+    void set_erase_range_callback(std::function<bool(std::uint64_t, std::uint32_t)> callback) {
+        erase_range_success_callback = callback;
+    }
     void set_unlock_callback(std::function<bool(std::uint64_t)> callback) {
         unlock_success_callback = callback;
     }
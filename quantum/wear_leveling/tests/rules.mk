@@ -63,4 +63,56 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_double_buffer_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_DOUBLE_BUFFER \
+	-DWEAR_LEVELING_ERASE_SLICE_SIZE=16
+wear_leveling_double_buffer_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_double_buffer.cpp
+wear_leveling_double_buffer_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_double_buffer_4byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_DOUBLE_BUFFER \
+	-DWEAR_LEVELING_ERASE_SLICE_SIZE=16
+wear_leveling_double_buffer_4byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_double_buffer.cpp
+wear_leveling_double_buffer_4byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_double_buffer_8byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_DOUBLE_BUFFER \
+	-DWEAR_LEVELING_ERASE_SLICE_SIZE=16
+wear_leveling_double_buffer_8byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_double_buffer.cpp
+wear_leveling_double_buffer_8byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_FLUSH_DELAY=1 \
+	-DWEAR_LEVELING_DIRTY_RANGE_COUNT=4
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_back.cpp
+wear_leveling_write_back_INC := \
 	$(wear_leveling_common_INC)
\ No newline at end of file
@@ -0,0 +1,263 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingDoubleBuffer : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        wear_leveling_init();
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const std::uint8_t value) {
+        verify_data[address] = value;
+        return wear_leveling_write(address, &value, sizeof(value));
+    }
+
+    // Writes single bytes until the write log of the bank in use is full and gets consolidated
+    void write_until_consolidated(std::uint8_t &value) {
+        for (std::size_t i = 0; i < LOG_SLOT_COUNT; ++i) {
+            auto status = test_write(i % WEAR_LEVELING_LOGICAL_SIZE, ++value);
+            ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Write failed";
+            if (status == WEAR_LEVELING_CONSOLIDATED) {
+                return;
+            }
+        }
+        FAIL() << "Write log was never consolidated";
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read back the data";
+        EXPECT_EQ(readback, verify_data) << "Readback does not match";
+    }
+
+    // Number of single-byte writes that fit in the write log of a bank
+    static constexpr std::size_t LOG_SLOT_COUNT = (WEAR_LEVELING_BANK_SIZE - WEAR_LEVELING_LOG_START) / BACKING_STORE_WRITE_SIZE;
+};
+
+/**
+ * This test verifies that the first write after initialisation occurs after the generation marker of the first bank.
+ */
+TEST_F(WearLevelingDoubleBuffer, FirstWriteOccursAfterMarker) {
+    auto& inst = MockBackingStore::Instance();
+    inst.reset_instance();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+    // A blank backing store is erased once, then the first bank is written with its hash and marker
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Blank backing store should have been erased once";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Nothing should need a ranged erase";
+    EXPECT_FALSE(wear_leveling_erase_pending()) << "Nothing should need erasing";
+
+    inst.reset_instance();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(test_write(0x02, 0x15), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    auto last = inst.log_end() - 1;
+    EXPECT_EQ(last->address, WEAR_LEVELING_LOG_START) << "Invalid first write address";
+}
+
+/**
+ * This test verifies that consolidation writes to the idle bank without erasing anything, and that the retired bank is then erased a slice at a time from its end.
+ */
+TEST_F(WearLevelingDoubleBuffer, ConsolidationDefersErase) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0;
+
+    auto erase_count = inst.erase_invoke_count();
+    write_until_consolidated(value);
+    EXPECT_EQ(inst.erase_invoke_count(), erase_count) << "Consolidation should not erase the backing store";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Consolidation should not erase the idle bank, it was already erased";
+    EXPECT_TRUE(wear_leveling_erase_pending()) << "Retired bank should need erasing";
+
+    // The retired bank is the first one, erased from its end
+    for (std::uint32_t i = 0; i < WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_ERASE_SLICE_SIZE; ++i) {
+        EXPECT_TRUE(wear_leveling_erase_pending()) << "Retired bank should still need erasing";
+        EXPECT_EQ(wear_leveling_erase_step(), WEAR_LEVELING_SUCCESS) << "Erase step failed";
+        auto last = inst.log_end() - 1;
+        EXPECT_TRUE(last->erased) << "Erase step should have erased a range";
+        EXPECT_EQ(last->address, WEAR_LEVELING_BANK_SIZE - (i + 1) * WEAR_LEVELING_ERASE_SLICE_SIZE) << "Slices should be erased from the end of the bank";
+        EXPECT_EQ(last->length, WEAR_LEVELING_ERASE_SLICE_SIZE) << "Erase step should erase a single slice";
+    }
+    EXPECT_FALSE(wear_leveling_erase_pending()) << "Retired bank should be fully erased";
+    EXPECT_TRUE(std::all_of(inst.storage_begin(), inst.storage_begin() + (WEAR_LEVELING_BANK_SIZE / BACKING_STORE_WRITE_SIZE), [](const auto& e) { return e.is_erased(); })) << "Retired bank should be blank";
+
+    // Nothing else to do
+    auto erase_range_count = inst.erase_range_invoke_count();
+    EXPECT_EQ(wear_leveling_erase_step(), WEAR_LEVELING_SUCCESS) << "Erase step failed";
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_range_count) << "Nothing should have been erased";
+
+    // The next consolidation goes back to the first bank, without erasing it again
+    write_until_consolidated(value);
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_range_count) << "Consolidation should not erase the idle bank, it was already erased";
+    verify_readback();
+}
+
+/**
+ * This test verifies that if the retired bank hasn't been erased by the time the bank in use fills up, consolidation erases it in-line.
+ */
+TEST_F(WearLevelingDoubleBuffer, ConsolidationFinishesPendingErase) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0;
+
+    write_until_consolidated(value);
+    EXPECT_EQ(wear_leveling_erase_step(), WEAR_LEVELING_SUCCESS) << "Erase step failed";
+
+    auto erase_range_count = inst.erase_range_invoke_count();
+    write_until_consolidated(value);
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_range_count + WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_ERASE_SLICE_SIZE - 1) << "Consolidation should have erased the rest of the retired bank";
+    EXPECT_TRUE(wear_leveling_erase_pending()) << "The other bank should now need erasing";
+    verify_readback();
+}
+
+/**
+ * This test verifies that the data survives re-initialisation, whichever bank is in use and however far the erase of the other bank got.
+ */
+TEST_F(WearLevelingDoubleBuffer, ReinitReadsNewestBank) {
+    std::uint8_t value = 0;
+
+    for (int i = 0; i < 5; ++i) {
+        write_until_consolidated(value);
+        EXPECT_EQ(test_write(0x03, ++value), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        for (int j = 0; j < i; ++j) {
+            wear_leveling_erase_step();
+        }
+
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        verify_readback();
+    }
+}
+
+/**
+ * This test verifies that if the consolidated data of the newest bank is corrupt, the previous bank is used instead.
+ */
+TEST_F(WearLevelingDoubleBuffer, CorruptNewestBank_PreviousBankUsed) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0;
+
+    write_until_consolidated(value);
+
+    // Invalidate the checksum of the second bank
+    auto hash = inst.storage_begin() + ((WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOGICAL_SIZE) / BACKING_STORE_WRITE_SIZE);
+    hash->erase();
+
+    // The first bank holds the same data, but its write log is full, so it gets consolidated into the second bank again after erasing it
+    auto erase_range_count = inst.erase_range_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Init returned incorrect status";
+    EXPECT_GT(inst.erase_range_invoke_count(), erase_range_count) << "Second bank should have been erased";
+    verify_readback();
+
+    EXPECT_EQ(test_write(0x04, ++value), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a failed consolidation keeps the previous bank in use, and is tried again on the next write.
+ */
+TEST_F(WearLevelingDoubleBuffer, FailedConsolidation_RetriedOnNextWrite) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0;
+
+    // Fail the first write of the generation marker of the second bank
+    bool failed = false;
+    inst.set_write_callback([&failed](std::uint64_t, std::uint32_t address) {
+        if (!failed && address == WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOGICAL_SIZE + 8) {
+            failed = true;
+            return false;
+        }
+        return true;
+    });
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (std::size_t i = 0; i < LOG_SLOT_COUNT && status == WEAR_LEVELING_SUCCESS; ++i) {
+        status = test_write(i % WEAR_LEVELING_LOGICAL_SIZE, ++value);
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_FAILED) << "Consolidation should have failed";
+    EXPECT_TRUE(wear_leveling_erase_pending()) << "The partly written bank should need erasing";
+    verify_readback();
+
+    // The next write erases the partly written bank and consolidates again
+    EXPECT_EQ(test_write(0x05, ++value), WEAR_LEVELING_CONSOLIDATED) << "Write should have consolidated";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a power loss at any point of writing, consolidating or erasing leaves readable data, which includes every write that
+ * succeeded before the power loss, and that the backing store can be written to afterwards.
+ *
+ * Power loss is emulated by failing every backing store operation from a given point onwards, then re-initialising. Each point is tried in turn,
+ * until the whole sequence of operations completes.
+ */
+TEST_F(WearLevelingDoubleBuffer, PowerLossAtEveryStep) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Enough writes for three consolidations, erasing a single slice of the retired bank after every other write
+    constexpr std::size_t write_count = LOG_SLOT_COUNT * 3 + 1;
+
+    bool completed = false;
+    for (std::uint64_t budget = 0; !completed; ++budget) {
+        ASSERT_LT(budget, 100000) << "Sequence never completed";
+
+        inst.reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+        // Fail every operation once the budget is used up
+        std::uint64_t ops        = 0;
+        bool          power_lost = false;
+        auto          powered    = [&]() {
+            if (ops++ < budget) {
+                return true;
+            }
+            power_lost = true;
+            return false;
+        };
+        inst.set_write_callback([&](std::uint64_t, std::uint32_t) { return powered(); });
+        inst.set_erase_callback([&](std::uint64_t) { return powered(); });
+        inst.set_erase_range_callback([&](std::uint64_t, std::uint32_t) { return powered(); });
+
+        // Keep a snapshot of the data after each write
+        std::vector<std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>> snapshots{verify_data};
+        std::size_t                                                       acknowledged = 0;
+        for (std::size_t i = 0; i < write_count && !power_lost; ++i) {
+            auto status = test_write((i * 5) % WEAR_LEVELING_LOGICAL_SIZE, (std::uint8_t)(i + 1));
+            snapshots.push_back(verify_data);
+            if (status != WEAR_LEVELING_FAILED && !power_lost) {
+                acknowledged = snapshots.size() - 1;
+            }
+            if (i % 2 == 1) {
+                wear_leveling_erase_step();
+            }
+        }
+        completed = !power_lost;
+
+        // Restore power
+        inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+        inst.set_erase_callback([](std::uint64_t) { return true; });
+        inst.set_erase_range_callback([](std::uint64_t, std::uint32_t) { return true; });
+
+        ASSERT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init failed after power loss at operation " << budget;
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        ASSERT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read back the data";
+
+        auto found = std::find(snapshots.begin() + acknowledged, snapshots.end(), readback);
+        ASSERT_NE(found, snapshots.end()) << "Data after power loss at operation " << budget << " does not match any write since the last one to succeed";
+
+        // Everything still works afterwards, including further consolidations
+        verify_data = readback;
+        std::uint8_t value = 0x80;
+        for (std::size_t i = 0; i < LOG_SLOT_COUNT * 2; ++i) {
+            ASSERT_NE(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, ++value), WEAR_LEVELING_FAILED) << "Write failed after power loss at operation " << budget;
+            wear_leveling_erase_step();
+        }
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        verify_readback();
+    }
+}
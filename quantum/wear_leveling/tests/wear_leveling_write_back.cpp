@@ -0,0 +1,212 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstdio>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        wear_leveling_init();
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write_deferred(const uint32_t address, const std::uint8_t value) {
+        verify_data[address] = value;
+        return wear_leveling_write_deferred(address, &value, sizeof(value));
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read back the data";
+        EXPECT_EQ(readback, verify_data) << "Readback does not match";
+    }
+};
+
+/**
+ * This test verifies that deferred writes are visible to reads straight away, but only reach the backing store when flushed.
+ */
+TEST_F(WearLevelingWriteBack, DeferredWrites_OnlyWrittenOnFlush) {
+    auto& inst = MockBackingStore::Instance();
+
+    auto write_count  = inst.write_invoke_count();
+    auto unlock_count = inst.unlock_invoke_count();
+    EXPECT_EQ(test_write_deferred(0x02, 0x15), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_EQ(test_write_deferred(0x09, 0x16), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Deferred writes should not reach the backing store";
+    EXPECT_EQ(inst.unlock_invoke_count(), unlock_count) << "Deferred writes should not unlock the backing store";
+    EXPECT_TRUE(wear_leveling_flush_pending()) << "Deferred writes should be pending";
+    verify_readback();
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_GT(inst.write_invoke_count(), write_count) << "Flush should have written to the backing store";
+    EXPECT_EQ(inst.unlock_invoke_count(), unlock_count + 1) << "Flush should unlock the backing store once";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Nothing should be pending after a flush";
+
+    // Nothing left to do
+    write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Empty flush should not write";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that writing the value already present does not leave anything to flush.
+ */
+TEST_F(WearLevelingWriteBack, SameValue_NothingPending) {
+    EXPECT_EQ(test_write_deferred(0x03, 0x00), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Unchanged data should not be pending";
+}
+
+/**
+ * This test verifies that single-byte writes to adjacent and overlapping addresses are written to the log as one range, and take fewer log entries than
+ * writing each of them straight away.
+ */
+TEST_F(WearLevelingWriteBack, AdjacentWrites_FlushedAsOneRange) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Written out of order, with one address written twice
+    const std::array<std::uint32_t, 8> addresses = {4, 5, 3, 6, 2, 5, 7, 1};
+
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        std::uint8_t value = 0x40 + i;
+        wear_leveling_write(addresses[i], &value, sizeof(value));
+    }
+    auto immediate_writes = inst.write_invoke_count();
+
+    inst.reset_instance();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    auto write_count = inst.write_invoke_count();
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        EXPECT_EQ(test_write_deferred(addresses[i], 0x40 + i), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_LT(inst.write_invoke_count() - write_count, immediate_writes) << "Merged range should take fewer backing store writes";
+
+    // The log starts with a single multibyte entry covering addresses 1 to 5
+    write_log_entry_t entry = {.raw64 = 0};
+    EXPECT_TRUE(inst.read(WEAR_LEVELING_LOGICAL_SIZE + 8, entry.raw32[0])) << "Failed to read the log";
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(entry), LOG_ENTRY_TYPE_MULTIBYTE) << "First log entry should be multibyte";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(entry), 1) << "First log entry should start at the lowest address";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_LENGTH(entry), LOG_ENTRY_MULTIBYTE_MAX_BYTES) << "First log entry should be full";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that once too many separate ranges are pending, they are flushed to make room for the next.
+ */
+TEST_F(WearLevelingWriteBack, TooManyRanges_PendingFlushed) {
+    auto& inst = MockBackingStore::Instance();
+
+    auto write_count = inst.write_invoke_count();
+    for (std::uint32_t i = 0; i < WEAR_LEVELING_DIRTY_RANGE_COUNT; ++i) {
+        EXPECT_EQ(test_write_deferred(i * 3, 0x50 + i), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Ranges should still be pending";
+
+    // One more separate range
+    EXPECT_EQ(test_write_deferred(WEAR_LEVELING_LOGICAL_SIZE - 1, 0x60), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_GT(inst.write_invoke_count(), write_count) << "Pending ranges should have been flushed";
+    EXPECT_TRUE(wear_leveling_flush_pending()) << "The last write should still be pending";
+
+    // Joining onto an existing range doesn't need another one
+    write_count = inst.write_invoke_count();
+    EXPECT_EQ(test_write_deferred(WEAR_LEVELING_LOGICAL_SIZE - 2, 0x61), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Adjacent write should have been merged";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that ranges which fail to be written are kept for the next flush.
+ */
+TEST_F(WearLevelingWriteBack, FlushFailure_RangesKept) {
+    auto& inst = MockBackingStore::Instance();
+
+    EXPECT_EQ(test_write_deferred(0x01, 0x21), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_EQ(test_write_deferred(0x08, 0x22), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush should have failed";
+    EXPECT_TRUE(wear_leveling_flush_pending()) << "Ranges should still be pending";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Nothing should be pending after a flush";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a flush that fills the write log consolidates everything pending.
+ */
+TEST_F(WearLevelingWriteBack, FlushConsolidation_NothingPending) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (std::uint32_t i = 0; i < WEAR_LEVELING_BACKING_SIZE && status == WEAR_LEVELING_SUCCESS; ++i) {
+        EXPECT_EQ(test_write_deferred(i % WEAR_LEVELING_LOGICAL_SIZE, i + 1), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+        EXPECT_EQ(test_write_deferred((i + 7) % WEAR_LEVELING_LOGICAL_SIZE, i + 2), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+        status = wear_leveling_flush();
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Flushes should have filled the write log";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Nothing should be pending after consolidation";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that erasing drops any pending writes.
+ */
+TEST_F(WearLevelingWriteBack, Erase_DropsPendingWrites) {
+    EXPECT_EQ(test_write_deferred(0x04, 0x31), WEAR_LEVELING_SUCCESS) << "Deferred write returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Erase should drop pending writes";
+
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+    verify_readback();
+}
+
+/**
+ * This test compares the backing store writes needed for a burst of updates to a small settings block, such as from dragging a colour slider, with and without
+ * deferring them.
+ */
+TEST_F(WearLevelingWriteBack, SliderBurst_BackingStoreWrites) {
+    auto& inst = MockBackingStore::Instance();
+
+    // A 4-byte settings block, with the value in its second byte updated 200 times
+    auto burst = [](auto write) {
+        for (int i = 0; i < 200; ++i) {
+            std::uint8_t block[4] = {0x01, (std::uint8_t)(i + 1), 0x80, 0xFF};
+            for (std::uint32_t j = 0; j < sizeof(block); ++j) {
+                write(0x10 + j, block[j]);
+            }
+        }
+    };
+
+    burst([](std::uint32_t address, std::uint8_t value) { wear_leveling_write(address, &value, 1); });
+    auto immediate_writes = inst.write_invoke_count();
+
+    inst.reset_instance();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    burst([this](std::uint32_t address, std::uint8_t value) { test_write_deferred(address, value); });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    auto deferred_writes = inst.write_invoke_count();
+
+    printf("[ BENCHMARK] 200 slider updates: %u backing store writes immediately, %u deferred\n", (unsigned)immediate_writes, (unsigned)deferred_writes);
+    EXPECT_LT(deferred_writes, immediate_writes) << "Deferred writes should take fewer backing store writes";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
@@ -76,6 +76,35 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+    Double buffering (WEAR_LEVELING_DOUBLE_BUFFER):
+
+        The backing store is split into two equally-sized banks, each laid
+        out as a whole backing store is without double buffering, with an
+        8-byte generation marker between the FNV1a_64 hash and the write log.
+        The marker holds a 32-bit generation number followed by its
+        complement, so that a partially written or erased marker is not
+        mistaken for a valid one.
+
+        During initialization, the bank with the highest generation whose
+        consolidated data matches its hash is used.
+
+        When the write log fills, the cache is consolidated into the other
+        bank, which is already erased, and its marker is written last with the
+        next generation. Until then, a power loss leaves the previous bank in
+        use with its full write log. Once the marker is written the previous
+        bank is retired, and erased a slice at a time by
+        wear_leveling_erase_step(), starting from its end, so that its marker
+        is the last thing to go. Only if the new bank fills before that is done
+        is the rest erased in-line.
+
+    Deferred writes (WEAR_LEVELING_FLUSH_DELAY):
+
+        wear_leveling_write_deferred() only updates the cache, and keeps track
+        of the ranges it changed. Overlapping and adjacent ranges are merged,
+        so that wear_leveling_flush() appends each contiguous range to the
+        write log in one go, as multi-byte entries, instead of one entry per
+        small write. Deciding when to flush is left to the caller.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -162,8 +191,32 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    uint32_t bank_base;       // Start of the bank in use
+    uint32_t generation;      // Generation of the bank in use, 0 if neither bank has been written yet
+    uint32_t erase_remaining; // Number of bytes at the start of the other bank still to be erased
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+/**
+ * Ranges of the cache changed by deferred writes, not yet written to the backing store.
+ * Kept sorted by address, with no two ranges overlapping or adjacent.
+ */
+static struct {
+    uint32_t start;
+    uint32_t end;
+} dirty_ranges[WEAR_LEVELING_DIRTY_RANGE_COUNT];
+static uint8_t dirty_range_count = 0;
+#endif // WEAR_LEVELING_FLUSH_DELAY
+
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+#    define BANK_ADDRESS(offset) (wear_leveling.bank_base + (offset))
+#    define OTHER_BANK_BASE() ((WEAR_LEVELING_BANK_SIZE) - wear_leveling.bank_base)
+#else
+#    define BANK_ADDRESS(offset) (offset)
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
 /**
  * Locking helper: status
  */
@@ -202,18 +255,50 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+    dirty_range_count = 0;
+#endif // WEAR_LEVELING_FLUSH_DELAY
+}
+
+/**
+ * Reads an 8-byte value, such as the FNV1a_64 of the consolidated data, from the backing store.
+ */
+static bool wear_leveling_read_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
+}
+
+/**
+ * Writes an 8-byte value, such as the FNV1a_64 of the consolidated data, to the backing store.
+ */
+static bool wear_leveling_write_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
 }
 
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
+ *
+ * @param checksum_matches[out] whether the consolidated data matched its FNV1a_64, if the read succeeded
  */
-static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+static wear_leveling_status_t wear_leveling_read_consolidated(bool *checksum_matches) {
     wl_dprintf("Reading consolidated data\n");
 
+    *checksum_matches             = false;
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(BANK_ADDRESS(0), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -221,19 +306,14 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        write_log_entry_t entry;
+        write_log_entry_t entry    = {.raw64 = 0};
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_entry(BANK_ADDRESS(WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
+            *checksum_matches = true;
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
             wear_leveling_clear_cache();
@@ -249,7 +329,8 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 }
 
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
+ * Writes the current cache to consolidated data at the beginning of the backing store, or of the bank in use.
+ * With double buffering, the generation marker of the bank is written last.
  * Does not clear the write log.
  * Pre-condition: this is just after an erase, so we can write directly without reading.
  */
@@ -258,7 +339,7 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(BANK_ADDRESS(0), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -268,25 +349,21 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_entry(BANK_ADDRESS(WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    if (status != WEAR_LEVELING_FAILED) {
+        // Write out the generation marker, which makes the bank valid
+        write_log_entry_t entry = {.raw32 = {wear_leveling.generation, ~wear_leveling.generation}};
+        wl_dprintf("Writing generation %lu\n", (unsigned long)wear_leveling.generation);
+        if (!wear_leveling_write_entry(BANK_ADDRESS((WEAR_LEVELING_LOGICAL_SIZE) + 8), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
 
     if (lock_status == STATUS_SUCCESS) {
         wear_leveling_lock();
@@ -294,6 +371,152 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+
+/**
+ * Reads the generation marker of the bank starting at the supplied address.
+ *
+ * @return the generation of the bank, or 0 if it has no valid marker
+ */
+static uint32_t wear_leveling_read_generation(uint32_t bank_base) {
+    write_log_entry_t entry;
+    if (!wear_leveling_read_entry(bank_base + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry) || entry.raw32[1] != ~entry.raw32[0]) {
+        return 0;
+    }
+    return entry.raw32[0];
+}
+
+/**
+ * Checks whether the other bank is fully erased.
+ * The retired bank is erased from its end, so only the first slice and the bank header need checking.
+ */
+static bool wear_leveling_other_bank_is_erased(void) {
+    const uint32_t      base   = OTHER_BANK_BASE();
+    const uint32_t      length = (WEAR_LEVELING_ERASE_SLICE_SIZE) > WEAR_LEVELING_LOG_START ? (WEAR_LEVELING_ERASE_SLICE_SIZE) : WEAR_LEVELING_LOG_START;
+    backing_store_int_t value;
+    for (uint32_t offset = 0; offset < length; offset += (BACKING_STORE_WRITE_SIZE)) {
+        if (!backing_store_read(base + offset, &value) || value != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Erases the last slice of the other bank that is still to be erased.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_erase_slice(void) {
+    const uint32_t offset = wear_leveling.erase_remaining - (WEAR_LEVELING_ERASE_SLICE_SIZE);
+    wl_dprintf("Erasing retired bank at offset %lu\n", (unsigned long)offset);
+    if (!backing_store_erase_range(OTHER_BANK_BASE() + offset, (WEAR_LEVELING_ERASE_SLICE_SIZE))) {
+        wl_dprintf("Failed to erase retired bank\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.erase_remaining = offset;
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Forces a write of the current cache into the other bank, which then takes over.
+ * Finishes erasing the other bank first if that hasn't been done in the background yet.
+ * A power loss during this operation leaves the previous bank and its write log in use.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    while (wear_leveling.erase_remaining > 0) {
+        if (wear_leveling_erase_slice() == WEAR_LEVELING_FAILED) {
+            wear_leveling.write_address = (WEAR_LEVELING_BANK_SIZE);
+            return WEAR_LEVELING_FAILED;
+        }
+    }
+
+    const uint32_t previous_bank_base  = wear_leveling.bank_base;
+    const uint32_t previous_generation = wear_leveling.generation;
+
+    wear_leveling.bank_base  = OTHER_BANK_BASE();
+    wear_leveling.generation = previous_generation + 1;
+
+    // Write the cache to the first section of the bank, followed by the marker that makes it the bank in use.
+    wear_leveling_status_t status = wear_leveling_write_consolidated();
+    if (status == WEAR_LEVELING_FAILED) {
+        wl_dprintf("Failed to write consolidated data\n");
+
+        // Keep using the previous bank, with its write log treated as full so that the next write tries again. The partly written bank needs erasing first.
+        wear_leveling.bank_base       = previous_bank_base;
+        wear_leveling.generation      = previous_generation;
+        wear_leveling.erase_remaining = (WEAR_LEVELING_BANK_SIZE);
+        wear_leveling.write_address   = (WEAR_LEVELING_BANK_SIZE);
+        return status;
+    }
+
+    // The previous bank is now retired, and erased in the background. Without a previous generation there is nothing to erase.
+    wear_leveling.erase_remaining = previous_generation != 0 ? (WEAR_LEVELING_BANK_SIZE) : 0;
+
+    // Next write of the log occurs after the consolidated values at the start of the bank.
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+
+    return status;
+}
+
+/**
+ * Erases the whole backing store, and writes the current cache to the first bank.
+ */
+static wear_leveling_status_t wear_leveling_format(void) {
+    wl_dprintf("Erasing backing store\n");
+
+    bool ok = backing_store_erase();
+    if (!ok) {
+        wl_dprintf("Failed to erase backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Consolidating moves on to the first bank. Until that succeeds, the write log is treated as full so that no log entries are written without a valid bank.
+    wear_leveling.bank_base       = (WEAR_LEVELING_BANK_SIZE);
+    wear_leveling.generation      = 0;
+    wear_leveling.erase_remaining = 0;
+    wear_leveling.write_address   = (WEAR_LEVELING_BANK_SIZE);
+
+    return wear_leveling_consolidate_force();
+}
+
+/**
+ * Reads the consolidated data of the newest valid bank into the cache, and makes it the bank in use.
+ * Formats the backing store if neither bank is valid.
+ */
+static wear_leveling_status_t wear_leveling_read_banks(void) {
+    const uint32_t generations[2] = {wear_leveling_read_generation(0), wear_leveling_read_generation(WEAR_LEVELING_BANK_SIZE)};
+    const uint8_t  newest         = generations[1] > generations[0] ? 1 : 0;
+
+    // Try the newest bank first, falling back to the other one if its consolidated data is corrupt
+    for (uint8_t i = 0; i < 2; ++i) {
+        const uint8_t bank = newest ^ i;
+        if (generations[bank] == 0) {
+            continue;
+        }
+
+        wear_leveling.bank_base  = bank * (WEAR_LEVELING_BANK_SIZE);
+        wear_leveling.generation = generations[bank];
+
+        bool                   checksum_matches;
+        wear_leveling_status_t status = wear_leveling_read_consolidated(&checksum_matches);
+        if (status == WEAR_LEVELING_FAILED) {
+            return status;
+        }
+        if (checksum_matches) {
+            wl_dprintf("Using bank %d, generation %lu\n", (int)bank, (unsigned long)generations[bank]);
+            // Pick up erasing the other bank where a power loss may have interrupted it
+            wear_leveling.erase_remaining = wear_leveling_other_bank_is_erased() ? 0 : (WEAR_LEVELING_BANK_SIZE);
+            return WEAR_LEVELING_SUCCESS;
+        }
+    }
+
+    wl_dprintf("No valid bank, formatting\n");
+    wear_leveling_clear_cache();
+    return wear_leveling_format();
+}
+
+#else // WEAR_LEVELING_DOUBLE_BUFFER
+
 /**
  * Forces a write of the current cache.
  * Erases the backing store, including the write log.
@@ -316,11 +539,13 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
 
     return status;
 }
 
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
 /**
  * Potential write of the current cache to the backing store.
  * Skipped if the current write log position is not at the end of the backing store.
@@ -329,7 +554,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
 
@@ -342,7 +567,14 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    // A failed consolidation leaves the write log full, so try again. If it succeeds the cache has been written to the consolidated area.
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
+        return wear_leveling_consolidate_force();
+    }
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
+    bool ok = backing_store_write(BANK_ADDRESS(wear_leveling.write_address), value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
@@ -477,10 +709,10 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = WEAR_LEVELING_LOG_START;
+    while (!cancel_playback && address < (WEAR_LEVELING_BANK_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = backing_store_read(BANK_ADDRESS(address), &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -509,7 +741,12 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                if (address >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wl_dprintf("Log entry cut short by the end of the write log\n");
+                    cancel_playback = true;
+                    break;
+                }
+                ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -528,8 +765,13 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 
 #if BACKING_STORE_WRITE_SIZE == 2
+                if (l > 1 && address >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wl_dprintf("Log entry cut short by the end of the write log\n");
+                    cancel_playback = true;
+                    break;
+                }
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -538,8 +780,13 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     }
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
+                if (l > 3 && address >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wl_dprintf("Log entry cut short by the end of the write log\n");
+                    cancel_playback = true;
+                    break;
+                }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -549,8 +796,13 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
+                if (l > 1 && address >= (WEAR_LEVELING_BANK_SIZE)) {
+                    wl_dprintf("Log entry cut short by the end of the write log\n");
+                    cancel_playback = true;
+                    break;
+                }
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -627,8 +879,37 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    // Unlock the backing store, as picking a bank may need to format it or consolidate into the other one
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        wear_leveling_clear_cache();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Read the newest consolidated values, then replay the existing write log so that the cache has the "live" values
+    wear_leveling_status_t status = wear_leveling_read_banks();
+    if (status != WEAR_LEVELING_FAILED) {
+        status = wear_leveling_playback_log();
+    }
+
+    // Lock the backing store if we acquired the lock successfully
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (status == WEAR_LEVELING_FAILED) {
+        // If it failed, clear the cache and return with failure
+        wear_leveling_clear_cache();
+        return status;
+    }
+#else
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
+    bool                   checksum_matches;
+    wear_leveling_status_t status = wear_leveling_read_consolidated(&checksum_matches);
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -641,6 +922,7 @@ wear_leveling_status_t wear_leveling_init(void) {
         wear_leveling_clear_cache();
         return status;
     }
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
 
     return status;
 }
@@ -660,8 +942,13 @@ wear_leveling_status_t wear_leveling_erase(void) {
     }
 
     // Perform the erase
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+    wear_leveling_clear_cache();
+    bool ret = wear_leveling_format() != WEAR_LEVELING_FAILED;
+#else
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+#endif
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -726,6 +1013,137 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+
+/**
+ * Writes logical data into the cache only, keeping track of the changed range until the next flush.
+ */
+wear_leveling_status_t wear_leveling_write_deferred(const uint32_t address, const void *value, size_t length) {
+    wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
+    if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wl_dprintf("Deferred write ");
+    wl_dump(address, value, length);
+
+    // Skip write if there's no change compared to the current cached value
+    if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    memcpy(&wear_leveling.cache[address], value, length);
+
+    // Absorb any ranges overlapping or adjacent to this one, keeping the rest in order
+    uint32_t start    = address;
+    uint32_t end      = address + length;
+    uint8_t  count    = 0;
+    uint8_t  position = 0;
+    for (uint8_t i = 0; i < dirty_range_count; ++i) {
+        if (dirty_ranges[i].end < start) {
+            dirty_ranges[count++] = dirty_ranges[i];
+            position              = count;
+        } else if (dirty_ranges[i].start > end) {
+            dirty_ranges[count++] = dirty_ranges[i];
+        } else {
+            start = dirty_ranges[i].start < start ? dirty_ranges[i].start : start;
+            end   = dirty_ranges[i].end > end ? dirty_ranges[i].end : end;
+        }
+    }
+    dirty_range_count = count;
+
+    // Out of ranges, write out the ones already pending so that this one can be kept
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (dirty_range_count == (WEAR_LEVELING_DIRTY_RANGE_COUNT)) {
+        status = wear_leveling_flush();
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            // Consolidation wrote out the whole cache, including this write
+            return status;
+        }
+
+        position = 0;
+        while (position < dirty_range_count && dirty_ranges[position].end < start) {
+            ++position;
+        }
+
+        if (dirty_range_count == (WEAR_LEVELING_DIRTY_RANGE_COUNT)) {
+            // The flush failed, so widen a neighbouring range to cover this write -- the unchanged bytes in between get rewritten
+            uint8_t nearest = position > 0 ? position - 1 : 0;
+            if (dirty_ranges[nearest].start > start) {
+                dirty_ranges[nearest].start = start;
+            }
+            if (dirty_ranges[nearest].end < end) {
+                dirty_ranges[nearest].end = end;
+            }
+            return status;
+        }
+    }
+
+    memmove(&dirty_ranges[position + 1], &dirty_ranges[position], (dirty_range_count - position) * sizeof(dirty_ranges[0]));
+    dirty_ranges[position].start = start;
+    dirty_ranges[position].end   = end;
+    ++dirty_range_count;
+
+    return status;
+}
+
+/**
+ * Writes the ranges changed by deferred writes to the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    if (dirty_range_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Write out each range from the cache, keeping any that fail for the next flush
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    uint8_t                i      = 0;
+    while (i < dirty_range_count) {
+        status = wear_leveling_write_raw(dirty_ranges[i].start, &wear_leveling.cache[dirty_ranges[i].start], dirty_ranges[i].end - dirty_ranges[i].start);
+        if (status == WEAR_LEVELING_SUCCESS) {
+            status = wear_leveling_consolidate_if_needed();
+        }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            // The whole cache has been written to the consolidated area, nothing else is pending
+            i = dirty_range_count;
+            break;
+        }
+        if (status == WEAR_LEVELING_FAILED) {
+            break;
+        }
+        ++i;
+    }
+    memmove(&dirty_ranges[0], &dirty_ranges[i], (dirty_range_count - i) * sizeof(dirty_ranges[0]));
+    dirty_range_count -= i;
+
+    // Lock the backing store if we acquired the lock successfully
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Whether any deferred writes are waiting for a flush.
+ */
+bool wear_leveling_flush_pending(void) {
+    return dirty_range_count > 0;
+}
+
+#endif // WEAR_LEVELING_FLUSH_DELAY
+
 /**
  * Reads logical data from the cache.
  */
@@ -743,6 +1161,44 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+
+/**
+ * Whether the bank retired by the last consolidation still needs erasing.
+ */
+bool wear_leveling_erase_pending(void) {
+    return wear_leveling.erase_remaining > 0;
+}
+
+/**
+ * Erases the next slice of the bank retired by the last consolidation.
+ */
+wear_leveling_status_t wear_leveling_erase_step(void) {
+    if (wear_leveling.erase_remaining == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_erase_slice();
+
+    // Lock the backing store if we acquired the lock successfully
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,62 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+
+/**
+ * Writes logical data into the cache, deferring the write to the backing store until the next flush.
+ *
+ * Skips writes if there are no changes to written values. Changed ranges that overlap or touch are merged, so that
+ * they're written to the log together. If too many separate ranges are pending, those already pending are flushed.
+ *
+ * @param address[in] the logical address to write data
+ * @param value[in] pointer to the source buffer
+ * @param length[in] length of the data
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_write_deferred(uint32_t address, const void* value, size_t length);
+
+/**
+ * Writes any data from deferred writes to the backing store.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Whether any deferred writes are waiting for a flush.
+ *
+ * @return true if wear_leveling_flush() has work to do
+ */
+bool wear_leveling_flush_pending(void);
+
+#endif // WEAR_LEVELING_FLUSH_DELAY
+
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+
+/**
+ * How long input has to be idle, in milliseconds, before the keyboard task starts erasing the retired bank.
+ */
+#    ifndef WEAR_LEVELING_ERASE_IDLE_TIME
+#        define WEAR_LEVELING_ERASE_IDLE_TIME 1000
+#    endif
+
+/**
+ * Whether the bank retired by the last consolidation still needs erasing.
+ *
+ * @return true if wear_leveling_erase_step() has work left to do
+ */
+bool wear_leveling_erase_pending(void);
+
+/**
+ * Erases the next WEAR_LEVELING_ERASE_SLICE_SIZE bytes of the bank retired by the last consolidation.
+ *
+ * Intended to be called while the keyboard is idle, so that the next consolidation does not have to wait for an erase.
+ * Any part of the bank still to be erased is otherwise erased by the next consolidation.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_erase_step(void);
+
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
@@ -66,10 +66,37 @@ _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_DOUBLE_BUFFER
+// The backing store is split into two banks, each with its own consolidated data and write log
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+// The write log follows the FNV1a_64 of the consolidated data and the generation marker of the bank
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 16)
+// The number of bytes of the retired bank erased per call to wear_leveling_erase_step()
+#    ifndef WEAR_LEVELING_ERASE_SLICE_SIZE
+#        define WEAR_LEVELING_ERASE_SLICE_SIZE (WEAR_LEVELING_BANK_SIZE)
+#    endif
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Each bank must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Bank size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_ERASE_SLICE_SIZE == 0, "Bank size must be a multiple of the erase slice size");
+#else
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+// The write log follows the FNV1a_64 of the consolidated data
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8)
+#endif // WEAR_LEVELING_DOUBLE_BUFFER
+
+#ifdef WEAR_LEVELING_FLUSH_DELAY
+// The number of separate ranges deferred writes can change before they need flushing
+#    ifndef WEAR_LEVELING_DIRTY_RANGE_COUNT
+#        define WEAR_LEVELING_DIRTY_RANGE_COUNT 8
+#    endif
+_Static_assert(WEAR_LEVELING_DIRTY_RANGE_COUNT > 0 && WEAR_LEVELING_DIRTY_RANGE_COUNT <= 255, "Dirty range count must be between 1 and 255");
+#endif // WEAR_LEVELING_FLUSH_DELAY
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, uint32_t length); // only required for WEAR_LEVELING_DOUBLE_BUFFER, erases whole erase units within the range
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
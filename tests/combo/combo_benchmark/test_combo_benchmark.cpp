@@ -0,0 +1,120 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" {
+#include "process_combo.h"
+#include "keymap_introspection.h"
+
+static uint32_t combos_visited;
+
+// Every combo process_combo() looks at goes through here
+combo_t *combo_get(uint16_t combo_idx) {
+    ++combos_visited;
+    return combo_get_raw(combo_idx);
+}
+}
+
+class ComboBenchmark : public TestFixture {
+   public:
+    // Average cost of a single event, measured on process_combo() itself.
+    double process_combo_ns(uint16_t keycode, int iterations) {
+        keyrecord_t record = {};
+        record.event.type  = KEY_EVENT;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            record.event.pressed = !(i & 1);
+            process_combo(keycode, &record);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    // Combos looked at for a press and release of keycode, which does not depend on the host.
+    uint32_t combos_visited_per_tap(uint16_t keycode) {
+        keyrecord_t record = {};
+        record.event.type  = KEY_EVENT;
+
+        combos_visited = 0;
+        record.event.pressed = true;
+        process_combo(keycode, &record);
+        record.event.pressed = false;
+        process_combo(keycode, &record);
+        return combos_visited;
+    }
+
+    void report(const char *name, double ns) {
+        printf("[ BENCHMARK] %u combos, %s: %.0f ns/event (%s)\n", (unsigned)combo_count(), name, ns,
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+               "indexed"
+#else
+               "linear scan"
+#endif
+        );
+    }
+};
+
+TEST_F(ComboBenchmark, combo_still_fires) {
+    TestDriver driver;
+    // combo 27 is {KC_B, KC_D, KC_8} -> KC_F4
+    KeymapKey key_b(0, 0, 0, KC_B);
+    KeymapKey key_d(0, 1, 0, KC_D);
+    KeymapKey key_8(0, 2, 0, KC_8);
+    set_keymap({key_b, key_d, key_8});
+
+    EXPECT_REPORT(driver, (KC_F4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_d, key_8});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboBenchmark, combos_visited_per_event) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_ENTER);
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    // KC_ENTER is not part of any combo, KC_A is part of 40 and KC_1 of 52
+    uint32_t non_combo = combos_visited_per_tap(KC_ENTER);
+    uint32_t letter    = combos_visited_per_tap(KC_A);
+    uint32_t digit     = combos_visited_per_tap(KC_1);
+    printf("[ COUNT    ] %u combos, visited per tap: non-combo key %u, letter %u, digit %u\n", (unsigned)combo_count(), (unsigned)non_combo, (unsigned)letter, (unsigned)digit);
+
+#ifdef COMBO_KEYCODE_INDEX_SIZE
+    // Only the combos holding the key are looked at, a few times each on the press and the release
+    EXPECT_EQ(non_combo, 0u);
+    EXPECT_LE(letter, 3u * 40);
+    EXPECT_LE(digit, 3u * 52);
+#else
+    // The linear scan looks at every combo on the press and the release
+    EXPECT_GE(non_combo, 2u * combo_count());
+    EXPECT_GE(letter, 2u * combo_count());
+    EXPECT_GE(digit, 2u * combo_count());
+#endif
+}
+
+TEST_F(ComboBenchmark, benchmark) {
+    TestDriver driver;
+    // Buffered events are flushed through the regular pipeline
+    KeymapKey key(0, 0, 0, KC_ENTER);
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    const int iterations = 20000;
+
+    // KC_ENTER is not part of any combo, KC_A is part of 40 and KC_1 of 52
+    report("non-combo key", process_combo_ns(KC_ENTER, iterations));
+    report("letter", process_combo_ns(KC_A, iterations));
+    report("digit", process_combo_ns(KC_1, iterations));
+}
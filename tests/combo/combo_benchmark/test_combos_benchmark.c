@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* 520 three key combos: every combo contains two letters and a digit, so each
+ * letter is part of about 40 combos and each digit of 52. */
+#define BENCH_COMBO_COUNT 520
+
+#define BENCH_KEYS(n) {KC_A + ((n) % 26), KC_A + (((n) % 26 + 1 + (n) / 26) % 26), KC_1 + ((n) % 10), COMBO_END}
+#define BENCH_COMBO(n) COMBO(bench_keys[n], KC_F1 + ((n) % 12))
+
+#define R2(m, n) m(n), m((n) + 1)
+#define R4(m, n) R2(m, n), R2(m, (n) + 2)
+#define R8(m, n) R4(m, n), R4(m, (n) + 4)
+#define R16(m, n) R8(m, n), R8(m, (n) + 8)
+#define R32(m, n) R16(m, n), R16(m, (n) + 16)
+#define R64(m, n) R32(m, n), R32(m, (n) + 32)
+#define R128(m, n) R64(m, n), R64(m, (n) + 64)
+#define R256(m, n) R128(m, n), R128(m, (n) + 128)
+#define R520(m, n) R256(m, n), R256(m, (n) + 256), R8(m, (n) + 512)
+
+static const uint16_t PROGMEM bench_keys[BENCH_COMBO_COUNT][4] = {R520(BENCH_KEYS, 0)};
+
+combo_t key_combos[] = {R520(BENCH_COMBO, 0)};
@@ -0,0 +1,5 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Same combos and benchmark as combo_benchmark, with the keycode index enabled.
+#include "../combo_benchmark/test_combo_benchmark.cpp"
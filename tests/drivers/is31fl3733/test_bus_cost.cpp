@@ -0,0 +1,139 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "rgb_matrix.h"
+
+// clang-format off
+const is31fl3733_led_t PROGMEM g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+    {0, SW1_CS1, SW2_CS1, SW3_CS1},
+    {0, SW4_CS2, SW5_CS2, SW6_CS2},
+    {0, SW7_CS3, SW8_CS3, SW9_CS3},
+    {0, SW10_CS4, SW11_CS4, SW12_CS4},
+};
+
+led_config_t g_led_config = {{
+    {0, 1, 2, 3, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+}, {
+    {0, 0}, {16, 0}, {32, 0}, {48, 0}
+}, {
+    4, 4, 4, 4
+}};
+// clang-format on
+}
+
+static const uint8_t  DRIVER_ADDRESS = IS31FL3733_I2C_ADDRESS_1 << 1;
+static const uint32_t SEVERAL_FRAMES = RGB_MATRIX_LED_FLUSH_LIMIT * 10;
+
+// A page select is an unlock followed by the page, then each PWM chunk is a
+// register write of one SW row. Each LED has its channels in three rows, and
+// between them the LEDs cover all twelve.
+static const uint32_t PAGE_SELECT_BYTES = 2 * 2;
+static const uint32_t CHUNK_BYTES       = 1 + 16;
+
+class BusCost : public TestFixture {
+   public:
+    void settle(void) {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        idle_for(SEVERAL_FRAMES);
+        i2c_recorder_clear();
+    }
+};
+
+TEST_F(BusCost, unchanged_frames_are_not_sent) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    idle_for(SEVERAL_FRAMES);
+    EXPECT_EQ(i2c_recorder_get_stats().transactions, 0);
+}
+
+TEST_F(BusCost, colour_change_is_sent_once) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    idle_for(SEVERAL_FRAMES);
+
+    bus_stats_t stats = i2c_recorder_get_stats();
+    EXPECT_EQ(stats.bytes, PAGE_SELECT_BYTES + 12 * CHUNK_BYTES);
+    EXPECT_EQ(stats.unlogged, 0);
+
+    size_t              count;
+    const bus_record_t *log = i2c_recorder_get_log(&count);
+    ASSERT_EQ(count, stats.transactions);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(log[i].device, DRIVER_ADDRESS);
+        EXPECT_FALSE(log[i].read);
+    }
+}
+
+TEST_F(BusCost, single_led_sends_its_rows) {
+    is31fl3733_init_drivers();
+    is31fl3733_set_color_all(0, 0, 0);
+    is31fl3733_flush();
+    i2c_recorder_clear();
+
+    is31fl3733_set_color(2, 0, 0x40, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_recorder_get_stats().bytes, PAGE_SELECT_BYTES + 3 * CHUNK_BYTES);
+
+    i2c_recorder_clear();
+    is31fl3733_set_color(2, 0, 0x40, 0);
+    is31fl3733_flush();
+    EXPECT_EQ(i2c_recorder_get_stats().transactions, 0);
+}
+
+TEST_F(BusCost, absent_driver_is_still_costed) {
+    is31fl3733_init_drivers();
+    i2c_recorder_set_absent(DRIVER_ADDRESS, true);
+    i2c_recorder_clear();
+
+    is31fl3733_set_color_all(0x10, 0x20, 0x30);
+    is31fl3733_flush();
+    i2c_recorder_set_absent(DRIVER_ADDRESS, false);
+
+    bus_stats_t stats = i2c_recorder_get_stats();
+    EXPECT_GT(stats.transactions, 0);
+    EXPECT_EQ(stats.bytes, 0);
+    EXPECT_GT(stats.time_ns, 0);
+}
+
+TEST_F(BusCost, benchmark) {
+    struct {
+        const char *name;
+        uint32_t    clock_hz;
+    } clocks[] = {{"100kHz", 100000}, {"400kHz", 400000}, {"1MHz", 1000000}};
+
+    for (auto &clock : clocks) {
+        i2c_recorder_set_clock(clock.clock_hz);
+        is31fl3733_init_drivers();
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+
+        i2c_recorder_clear();
+        is31fl3733_set_color_all(0x10, 0x20, 0x30);
+        is31fl3733_flush();
+        bus_stats_t all = i2c_recorder_get_stats();
+
+        i2c_recorder_clear();
+        is31fl3733_set_color(0, 0x40, 0x20, 0x30);
+        is31fl3733_flush();
+        bus_stats_t one = i2c_recorder_get_stats();
+
+        printf("[ BENCHMARK] is31fl3733 %-6s all LEDs: %3u bytes %7.1f us, one LED: %3u bytes %7.1f us\n", clock.name, (unsigned)all.bytes, all.time_ns / 1000.0, (unsigned)one.bytes, one.time_ns / 1000.0);
+    }
+    i2c_recorder_set_clock(400000);
+}
@@ -0,0 +1,136 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "oled_driver.h"
+
+static const char *status = "Layer 0";
+
+bool oled_task_user(void) {
+    oled_write_ln(status, false);
+    return false;
+}
+}
+
+// Long enough for the OLED task to have redrawn the screen
+static const uint32_t SEVERAL_UPDATES = 500;
+
+// Each dirty block is sent as a positioning command followed by the block, both
+// prefixed with the control byte.
+static const uint32_t BLOCK_BYTES = (1 + 6) + (1 + OLED_BLOCK_SIZE);
+
+class BusCost : public TestFixture {
+   public:
+    void settle(void) {
+        status = "Layer 0";
+        oled_clear();
+        idle_for(SEVERAL_UPDATES);
+        i2c_recorder_clear();
+    }
+};
+
+TEST_F(BusCost, unchanged_screen_is_not_sent) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    idle_for(1000);
+    EXPECT_EQ(i2c_recorder_get_stats().transactions, 0);
+}
+
+TEST_F(BusCost, changed_text_sends_only_its_blocks) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    // The last character of the first line, which sits in a single block
+    status = "Layer 1";
+    idle_for(SEVERAL_UPDATES);
+
+    bus_stats_t stats = i2c_recorder_get_stats();
+    EXPECT_EQ(stats.bytes, BLOCK_BYTES);
+    EXPECT_EQ(stats.transactions, 2);
+
+    size_t              count;
+    const bus_record_t *log = i2c_recorder_get_log(&count);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(log[0].device, OLED_DISPLAY_ADDRESS << 1);
+    EXPECT_EQ(log[1].length, 1 + OLED_BLOCK_SIZE);
+}
+
+TEST_F(BusCost, whole_screen_sends_every_block) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+        oled_write_raw_byte(0x5A, i);
+    }
+    oled_render_dirty(true);
+
+    bus_stats_t stats = i2c_recorder_get_stats();
+    EXPECT_EQ(stats.bytes, OLED_BLOCK_COUNT * BLOCK_BYTES);
+    EXPECT_EQ(stats.transactions, OLED_BLOCK_COUNT * 2);
+}
+
+TEST_F(BusCost, bus_time_follows_the_clock) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    i2c_recorder_set_clock(400000);
+    oled_write_raw_byte(0x5A, 0);
+    oled_render_dirty(true);
+    uint64_t fast_ns = i2c_recorder_get_stats().time_ns;
+
+    i2c_recorder_clear();
+    i2c_recorder_set_clock(100000);
+    oled_write_raw_byte(0xA5, 0);
+    oled_render_dirty(true);
+    i2c_recorder_set_clock(400000);
+
+    // The same bytes, at a quarter of the clock
+    bus_stats_t stats = i2c_recorder_get_stats();
+    EXPECT_EQ(stats.bytes, BLOCK_BYTES);
+    EXPECT_EQ(stats.time_ns, fast_ns * 4);
+}
+
+TEST_F(BusCost, benchmark) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    struct {
+        const char *name;
+        uint32_t    clock_hz;
+    } clocks[] = {{"100kHz", 100000}, {"400kHz", 400000}, {"1MHz", 1000000}};
+
+    // Changes with each write, so that every write dirties its block
+    uint8_t pattern = 0;
+
+    for (auto &clock : clocks) {
+        i2c_recorder_set_clock(clock.clock_hz);
+
+        i2c_recorder_clear();
+        oled_write_raw_byte(++pattern, 0);
+        oled_render_dirty(true);
+        bus_stats_t one = i2c_recorder_get_stats();
+
+        i2c_recorder_clear();
+        ++pattern;
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+            oled_write_raw_byte(pattern, i);
+        }
+        oled_render_dirty(true);
+        bus_stats_t all = i2c_recorder_get_stats();
+
+        printf("[ BENCHMARK] oled i2c %-6s whole screen: %4u bytes %7.1f us, one block: %3u bytes %6.1f us\n", clock.name, (unsigned)all.bytes, all.time_ns / 1000.0, (unsigned)one.bytes, one.time_ns / 1000.0);
+    }
+    i2c_recorder_set_clock(400000);
+}
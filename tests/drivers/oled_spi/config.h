@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define OLED_DISPLAY_128X32
+#define OLED_TIMEOUT 0
+#define OLED_CS_PIN 1
+#define OLED_DC_PIN 2
+#define OLED_SPI_DIVISOR 4
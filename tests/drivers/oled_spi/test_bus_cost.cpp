@@ -0,0 +1,97 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "oled_driver.h"
+}
+
+// Long enough for the OLED task to have redrawn the screen
+static const uint32_t SEVERAL_UPDATES = 500;
+
+class BusCost : public TestFixture {
+   public:
+    void settle(void) {
+        oled_clear();
+        idle_for(SEVERAL_UPDATES);
+        spi_recorder_clear();
+    }
+};
+
+TEST_F(BusCost, dirty_block_is_one_command_and_one_data_transaction) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    oled_write_raw_byte(0x5A, 0);
+    idle_for(SEVERAL_UPDATES);
+
+    // Over SPI the command and data bytes go without the I2C control byte
+    bus_stats_t stats = spi_recorder_get_stats();
+    EXPECT_EQ(stats.transactions, 2);
+    EXPECT_EQ(stats.bytes, 6 + OLED_BLOCK_SIZE);
+
+    size_t              count;
+    const bus_record_t *log = spi_recorder_get_log(&count);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(log[0].device, OLED_CS_PIN);
+    EXPECT_EQ(log[1].length, OLED_BLOCK_SIZE);
+    EXPECT_FALSE(log[1].read);
+}
+
+TEST_F(BusCost, bus_time_follows_the_divisor) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    spi_recorder_set_clock(8000000);
+    oled_write_raw_byte(0xA5, 0);
+    oled_render_dirty(true);
+    spi_recorder_set_clock(48000000);
+
+    // 8MHz divided by 4 is two bits per microsecond
+    bus_stats_t stats = spi_recorder_get_stats();
+    EXPECT_EQ(stats.time_ns, stats.bytes * 8 * 500);
+}
+
+TEST_F(BusCost, whole_screen_sends_every_block) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+        oled_write_raw_byte(0x5A, i);
+    }
+    oled_render_dirty(true);
+
+    bus_stats_t stats = spi_recorder_get_stats();
+    EXPECT_EQ(stats.bytes, OLED_BLOCK_COUNT * (6 + OLED_BLOCK_SIZE));
+    EXPECT_EQ(stats.transactions, OLED_BLOCK_COUNT * 2);
+}
+
+TEST_F(BusCost, benchmark) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle();
+
+    uint8_t pattern = 0;
+    spi_recorder_clear();
+    oled_write_raw_byte(++pattern, 0);
+    oled_render_dirty(true);
+    bus_stats_t one = spi_recorder_get_stats();
+
+    spi_recorder_clear();
+    ++pattern;
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += OLED_BLOCK_SIZE) {
+        oled_write_raw_byte(pattern, i);
+    }
+    oled_render_dirty(true);
+    bus_stats_t all = spi_recorder_get_stats();
+
+    printf("[ BENCHMARK] oled spi 48MHz/%u whole screen: %4u bytes %7.1f us, one block: %3u bytes %6.1f us\n", OLED_SPI_DIVISOR, (unsigned)all.bytes, all.time_ns / 1000.0, (unsigned)one.bytes, one.time_ns / 1000.0);
+}
@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DISPLAY_CS_PIN 1
+#define DISPLAY_DC_PIN 2
+#define DISPLAY_RST_PIN 3
+#define DISPLAY_SPI_DIVISOR 2
+
+// One display per test suite, and a surface to draw from plus one to draw into
+#define ST7789_NUM_DEVICES 2
+#define SURFACE_NUM_DEVICES 3
@@ -0,0 +1,59 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "qp.h"
+#include "qp_st7789.h"
+}
+
+static const uint16_t WIDTH  = 240;
+static const uint16_t HEIGHT = 240;
+
+// The driver only has room for one device, so it is shared by the tests
+static painter_device_t display;
+
+class BusCost : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        TestFixture::SetUpTestCase();
+        display = qp_st7789_make_spi_device(WIDTH, HEIGHT, DISPLAY_CS_PIN, DISPLAY_DC_PIN, DISPLAY_RST_PIN, DISPLAY_SPI_DIVISOR, 0);
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+        qp_power(display, true);
+    }
+
+    bus_stats_t fill(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+        spi_recorder_clear();
+        qp_rect(display, left, top, right, bottom, 170, 255, 255, true);
+        qp_flush(display);
+        return spi_recorder_get_stats();
+    }
+};
+
+TEST_F(BusCost, fill_sends_two_bytes_per_pixel) {
+    bus_stats_t small = fill(0, 0, 9, 9);
+    bus_stats_t large = fill(0, 0, 19, 19);
+
+    // The same window setup either way, with RGB565 pixel data on top
+    EXPECT_EQ(large.bytes - small.bytes, (20 * 20 - 10 * 10) * 2);
+    EXPECT_GT(small.bytes, 10 * 10 * 2);
+}
+
+TEST_F(BusCost, full_screen_fill_sends_every_pixel) {
+    bus_stats_t full  = fill(0, 0, WIDTH - 1, HEIGHT - 1);
+    bus_stats_t glyph = fill(0, 0, 15, 15);
+
+    EXPECT_EQ(full.bytes - glyph.bytes, (WIDTH * HEIGHT - 16 * 16) * 2);
+}
+
+TEST_F(BusCost, benchmark) {
+    bus_stats_t full  = fill(0, 0, WIDTH - 1, HEIGHT - 1);
+    bus_stats_t glyph = fill(0, 0, 15, 15);
+
+    printf("[ BENCHMARK] st7789 spi 48MHz/%u full screen fill: %6u bytes %8.1f us, 16x16 fill: %4u bytes %6.1f us\n", DISPLAY_SPI_DIVISOR, (unsigned)full.bytes, full.time_ns / 1000.0, (unsigned)glyph.bytes, glyph.time_ns / 1000.0);
+}
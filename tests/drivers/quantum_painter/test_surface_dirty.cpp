@@ -0,0 +1,169 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "qp.h"
+#include "qp_st7789.h"
+#include "qp_surface_internal.h"
+}
+
+static const uint16_t WIDTH       = 240;
+static const uint16_t HEIGHT      = 240;
+static const uint16_t MONO_WIDTH  = 64;
+static const uint16_t MONO_HEIGHT = 32;
+
+static uint8_t rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDTH, HEIGHT, 16)];
+static uint8_t mono_source_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(MONO_WIDTH, MONO_HEIGHT, 1)];
+static uint8_t mono_target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(MONO_WIDTH, MONO_HEIGHT, 1)];
+
+// The drivers have no way to release a device, so these are shared by the tests
+static painter_device_t display;
+static painter_device_t rgb565_surface;
+static painter_device_t mono_source;
+static painter_device_t mono_target;
+
+class SurfaceDirty : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        TestFixture::SetUpTestCase();
+        display = qp_st7789_make_spi_device(WIDTH, HEIGHT, DISPLAY_CS_PIN, DISPLAY_DC_PIN, DISPLAY_RST_PIN, DISPLAY_SPI_DIVISOR, 0);
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+        qp_power(display, true);
+
+        rgb565_surface = qp_make_rgb565_surface(WIDTH, HEIGHT, rgb565_buffer);
+        mono_source    = qp_make_mono1bpp_surface(MONO_WIDTH, MONO_HEIGHT, mono_source_buffer);
+        mono_target    = qp_make_mono1bpp_surface(MONO_WIDTH, MONO_HEIGHT, mono_target_buffer);
+        ASSERT_TRUE(qp_init(rgb565_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_target, QP_ROTATION_0));
+    }
+
+    void SetUp() override {
+        TestFixture::SetUp();
+        qp_clear(rgb565_surface);
+        qp_clear(mono_source);
+        qp_clear(mono_target);
+        qp_flush(rgb565_surface);
+        qp_flush(mono_source);
+        qp_flush(mono_target);
+        hue += 16;
+    }
+
+    static surface_dirty_data_t &dirty(painter_device_t surface) {
+        return ((surface_painter_device_t *)surface)->dirty;
+    }
+
+    bus_stats_t draw_to_display(bool entire_surface = false) {
+        spi_recorder_clear();
+        EXPECT_TRUE(qp_surface_draw(rgb565_surface, display, 0, 0, entire_surface));
+        return spi_recorder_get_stats();
+    }
+
+    void fill(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+        qp_rect(rgb565_surface, left, top, right, bottom, hue, 255, 255, true);
+    }
+
+    uint8_t hue = 0;
+};
+
+TEST_F(SurfaceDirty, opposite_corners_are_sent_separately) {
+    fill(0, 0, 9, 9);
+    bus_stats_t one_corner = draw_to_display();
+
+    hue += 16;
+    fill(0, 0, 9, 9);
+    fill(WIDTH - 10, HEIGHT - 10, WIDTH - 1, HEIGHT - 1);
+    EXPECT_EQ(dirty(rgb565_surface).region_count, 2);
+    bus_stats_t two_corners = draw_to_display();
+
+    // Two windows of the same size cost twice as much as one, rather than the whole panel
+    EXPECT_EQ(two_corners.bytes, 2 * one_corner.bytes);
+    EXPECT_EQ(two_corners.transactions, 2 * one_corner.transactions);
+    EXPECT_FALSE(dirty(rgb565_surface).is_dirty);
+}
+
+TEST_F(SurfaceDirty, nearby_drawing_grows_one_region) {
+    fill(10, 10, 19, 19);
+    fill(20 + SURFACE_DIRTY_MERGE_DISTANCE - 1, 10, 29 + SURFACE_DIRTY_MERGE_DISTANCE, 19);
+
+    ASSERT_EQ(dirty(rgb565_surface).region_count, 1);
+    surface_dirty_region_t region = dirty(rgb565_surface).regions[0];
+    EXPECT_EQ(region.l, 10);
+    EXPECT_EQ(region.t, 10);
+    EXPECT_EQ(region.r, 29 + SURFACE_DIRTY_MERGE_DISTANCE);
+    EXPECT_EQ(region.b, 19);
+}
+
+TEST_F(SurfaceDirty, regions_that_meet_are_merged) {
+    fill(10, 10, 19, 19);
+    fill(10, 100, 19, 109);
+    ASSERT_EQ(dirty(rgb565_surface).region_count, 2);
+
+    // A bar joining both areas leaves a single region covering all three
+    fill(10, 20, 19, 99);
+    ASSERT_EQ(dirty(rgb565_surface).region_count, 1);
+    surface_dirty_region_t region = dirty(rgb565_surface).regions[0];
+    EXPECT_EQ(region.t, 10);
+    EXPECT_EQ(region.b, 109);
+}
+
+TEST_F(SurfaceDirty, extra_regions_grow_the_cheapest_one) {
+    // One more spot than there are regions for, the last right next to the first
+    for (int i = 0; i < SURFACE_DIRTY_REGION_COUNT; ++i) {
+        fill(i * 50, i * 50, i * 50 + 4, i * 50 + 4);
+    }
+    fill(0, 30, 4, 34);
+
+    ASSERT_EQ(dirty(rgb565_surface).region_count, SURFACE_DIRTY_REGION_COUNT);
+    surface_dirty_data_t &d = dirty(rgb565_surface);
+    EXPECT_EQ(d.regions[0].l, 0);
+    EXPECT_EQ(d.regions[0].t, 0);
+    EXPECT_EQ(d.regions[0].r, 4);
+    EXPECT_EQ(d.regions[0].b, 34);
+
+    // The bounding box covers everything
+    EXPECT_EQ(d.l, 0);
+    EXPECT_EQ(d.t, 0);
+    EXPECT_EQ(d.r, (SURFACE_DIRTY_REGION_COUNT - 1) * 50 + 4);
+    EXPECT_EQ(d.b, (SURFACE_DIRTY_REGION_COUNT - 1) * 50 + 4);
+}
+
+TEST_F(SurfaceDirty, entire_surface_ignores_regions) {
+    fill(0, 0, 9, 9);
+    bus_stats_t entire = draw_to_display(true);
+
+    EXPECT_GT(entire.bytes, WIDTH * HEIGHT * 2);
+}
+
+TEST_F(SurfaceDirty, mono_regions_are_copied_to_target) {
+    qp_rect(mono_source, 0, 0, 5, 2, 0, 0, 255, true);
+    qp_rect(mono_source, MONO_WIDTH - 3, MONO_HEIGHT - 7, MONO_WIDTH - 1, MONO_HEIGHT - 1, 0, 0, 255, true);
+    ASSERT_EQ(dirty(mono_source).region_count, 2);
+
+    ASSERT_TRUE(qp_surface_draw(mono_source, mono_target, 0, 0, false));
+    EXPECT_EQ(memcmp(mono_source_buffer, mono_target_buffer, sizeof(mono_target_buffer)), 0);
+
+    // Only the two corners were written to the target
+    EXPECT_EQ(dirty(mono_target).region_count, 2);
+    EXPECT_FALSE(dirty(mono_source).is_dirty);
+}
+
+TEST_F(SurfaceDirty, regions_cost_less_than_a_bounding_box) {
+    fill(0, 0, 47, 15);
+    fill(WIDTH - 32, HEIGHT - 16, WIDTH - 1, HEIGHT - 1);
+    bus_stats_t corners = draw_to_display();
+
+    // A single bounding box around both corners is the whole panel
+    hue += 16;
+    fill(0, 0, 47, 15);
+    bus_stats_t bounding_box = draw_to_display(true);
+
+    printf("[ COUNT    ] rgb565 surface to st7789, 48x16 and 32x16 in opposite corners: %6u bytes %8.1f us as regions, %6u bytes %8.1f us as one bounding box\n", (unsigned)corners.bytes, corners.time_ns / 1000.0, (unsigned)bounding_box.bytes, bounding_box.time_ns / 1000.0);
+    EXPECT_LT(corners.bytes * 20, bounding_box.bytes);
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "bus_recorder.h"
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_st7789.h"
+}
+
+static const uint16_t WIDTH  = 240;
+static const uint16_t HEIGHT = 240;
+
+// Bus time of one full buffer, at the 48MHz the recorder divides down from
+static const uint64_t CHUNK_NS = (uint64_t)QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE * 8 * DISPLAY_SPI_DIVISOR * 1000000000 / 48000000;
+
+// The driver only has room for one device, so it is shared by the tests
+static painter_device_t display;
+static uint8_t          chunk[QUANTUM_PAINTER_SPI_ASYNC_BUFFER_SIZE];
+
+class AsyncComms : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        TestFixture::SetUpTestCase();
+        display = qp_st7789_make_spi_device(WIDTH, HEIGHT, DISPLAY_CS_PIN, DISPLAY_DC_PIN, DISPLAY_RST_PIN, DISPLAY_SPI_DIVISOR, 0);
+        ASSERT_TRUE(qp_init(display, QP_ROTATION_0));
+        qp_power(display, true);
+    }
+
+    // Sends full chunks as a decoder would, spending decode_ns on each before handing it over
+    bus_stats_t stream(int chunks, uint32_t decode_ns) {
+        spi_recorder_clear();
+        EXPECT_TRUE(qp_comms_start(display));
+        for (int i = 0; i < chunks; ++i) {
+            spi_recorder_advance(decode_ns);
+            EXPECT_EQ(qp_comms_send(display, chunk, sizeof(chunk)), sizeof(chunk));
+        }
+        qp_comms_stop(display);
+        return spi_recorder_get_stats();
+    }
+};
+
+TEST_F(AsyncComms, fill_sends_two_bytes_per_pixel) {
+    spi_recorder_clear();
+    qp_rect(display, 0, 0, 9, 9, 170, 255, 255, true);
+    bus_stats_t small = spi_recorder_get_stats();
+
+    spi_recorder_clear();
+    qp_rect(display, 0, 0, 19, 19, 170, 255, 255, true);
+    bus_stats_t large = spi_recorder_get_stats();
+
+    // Exactly what the blocking path sends, and the call does not return before it is all out
+    EXPECT_EQ(large.bytes - small.bytes, (20 * 20 - 10 * 10) * 2);
+    EXPECT_EQ(large.elapsed_ns, large.time_ns);
+}
+
+TEST_F(AsyncComms, send_returns_before_data_is_out) {
+    spi_recorder_clear();
+    ASSERT_TRUE(qp_comms_start(display));
+    qp_comms_send(display, chunk, sizeof(chunk));
+    EXPECT_EQ(spi_recorder_get_stats().elapsed_ns, 0);
+
+    qp_comms_fence(display);
+    EXPECT_EQ(spi_recorder_get_stats().elapsed_ns, CHUNK_NS);
+    qp_comms_stop(display);
+}
+
+TEST_F(AsyncComms, command_waits_for_data) {
+    spi_recorder_clear();
+    ASSERT_TRUE(qp_comms_start(display));
+    qp_comms_send(display, chunk, sizeof(chunk));
+    qp_comms_command(display, 0x00);
+
+    // The command byte follows the whole chunk, so it does not go out with D/C flipped under the data
+    EXPECT_EQ(spi_recorder_get_stats().elapsed_ns, CHUNK_NS + 1 * 8 * DISPLAY_SPI_DIVISOR * 1000000000ULL / 48000000);
+    qp_comms_stop(display);
+}
+
+TEST_F(AsyncComms, decode_overlaps_transfer) {
+    const int      chunks    = 16;
+    const uint32_t decode_ns = CHUNK_NS / 2;
+    bus_stats_t    stats     = stream(chunks, decode_ns);
+
+    // Only the first decode is not hidden behind a transfer
+    EXPECT_EQ(stats.time_ns, chunks * CHUNK_NS);
+    EXPECT_EQ(stats.overlap_ns, (chunks - 1) * decode_ns);
+    EXPECT_EQ(stats.elapsed_ns, decode_ns + chunks * CHUNK_NS);
+}
+
+TEST_F(AsyncComms, slow_decode_keeps_bus_idle) {
+    const int      chunks    = 16;
+    const uint32_t decode_ns = CHUNK_NS * 2;
+    bus_stats_t    stats     = stream(chunks, decode_ns);
+
+    // Each transfer finishes while the next chunk is being decoded
+    EXPECT_EQ(stats.overlap_ns, (chunks - 1) * CHUNK_NS);
+    EXPECT_EQ(stats.elapsed_ns, chunks * decode_ns + CHUNK_NS);
+}
+
+TEST_F(AsyncComms, never_slower_than_blocking) {
+    const int chunks = 64;
+    for (uint32_t decode_ns : {0U, (uint32_t)(CHUNK_NS / 4), (uint32_t)(CHUNK_NS / 2), (uint32_t)CHUNK_NS}) {
+        bus_stats_t stats    = stream(chunks, decode_ns);
+        uint64_t    blocking = chunks * (decode_ns + CHUNK_NS);
+        printf("[ COUNT    ] st7789 spi 48MHz/%u %ux%u byte chunks, decode %6.1f us/chunk: %8.1f us async (%5.2f MB/s, %8.1f us overlapped), %8.1f us blocking (%5.2f MB/s)\n", DISPLAY_SPI_DIVISOR, chunks, (unsigned)sizeof(chunk), decode_ns / 1000.0, stats.elapsed_ns / 1000.0, stats.bytes * 1000.0 / stats.elapsed_ns, stats.overlap_ns / 1000.0, blocking / 1000.0, stats.bytes * 1000.0 / blocking);
+        EXPECT_EQ(stats.bytes, chunks * sizeof(chunk));
+        EXPECT_LE(stats.elapsed_ns, blocking) << decode_ns << "ns decode";
+    }
+}
@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Transient EEPROM that counts the reads going through it.
+
+#include <stdint.h>
+#include <string.h>
+#include "eeprom_driver.h"
+#include "counting_eeprom.h"
+
+static uint8_t eeprom_buffer[EEPROM_SIZE];
+uint32_t       counting_eeprom_reads = 0;
+
+void eeprom_driver_init(void) {}
+
+void eeprom_driver_format(bool erase) {
+    if (erase) {
+        eeprom_driver_erase();
+    }
+}
+
+void eeprom_driver_erase(void) {
+    memset(eeprom_buffer, 0x00, sizeof(eeprom_buffer));
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    ++counting_eeprom_reads;
+    memset(buf, 0x00, len);
+    if (offset < sizeof(eeprom_buffer)) {
+        memcpy(buf, &eeprom_buffer[offset], len < sizeof(eeprom_buffer) - offset ? len : sizeof(eeprom_buffer) - offset);
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    if (offset < sizeof(eeprom_buffer)) {
+        memcpy(&eeprom_buffer[offset], buf, len < sizeof(eeprom_buffer) - offset ? len : sizeof(eeprom_buffer) - offset);
+    }
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// Number of eeprom_read_block() calls, including those made by eeprom_read_byte()
+extern uint32_t counting_eeprom_reads;
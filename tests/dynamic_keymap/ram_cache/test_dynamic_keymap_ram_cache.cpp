@@ -0,0 +1,83 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Run the uncached tests against the cache as well
+#include "../test_dynamic_keymap.cpp"
+
+class DynamicKeymapRamCache : public DynamicKeymap {};
+
+TEST_F(DynamicKeymapRamCache, writes_are_deferred_until_idle) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint16_t before = stored_keycode(0, 1, 2);
+    dynamic_keymap_set_keycode(0, 1, 2, KC_C);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 2), KC_C);
+    EXPECT_EQ(stored_keycode(0, 1, 2), before);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY);
+    EXPECT_EQ(stored_keycode(0, 1, 2), before);
+
+    run_one_scan_loop();
+    EXPECT_EQ(stored_keycode(0, 1, 2), KC_C);
+}
+
+TEST_F(DynamicKeymapRamCache, further_writes_postpone_the_flush) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint16_t before_0 = stored_keycode(1, 0, 0);
+    uint16_t before_1 = stored_keycode(1, 0, 1);
+    dynamic_keymap_set_keycode(1, 0, 0, KC_D);
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY / 2);
+
+    uint8_t data[2] = {0x00, KC_E};
+    dynamic_keymap_set_buffer((1 * MATRIX_ROWS * MATRIX_COLS + 1) * 2, sizeof(data), data);
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY / 2 + 1);
+    EXPECT_EQ(stored_keycode(1, 0, 0), before_0);
+    EXPECT_EQ(stored_keycode(1, 0, 1), before_1);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY / 2);
+    EXPECT_EQ(stored_keycode(1, 0, 0), KC_D);
+    EXPECT_EQ(stored_keycode(1, 0, 1), KC_E);
+}
+
+TEST_F(DynamicKeymapRamCache, lookups_do_not_read_eeprom) {
+    dynamic_keymap_set_keycode(1, 3, 4, KC_H);
+    dynamic_keymap_flush();
+
+    // Anything written behind the cache's back is not seen by lookups
+    uint8_t other[2] = {0x00, KC_J};
+    eeprom_update_block(other, dynamic_keymap_key_to_eeprom_address(1, 3, 4), sizeof(other));
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 4), KC_H);
+    EXPECT_EQ(keycode_at_keymap_location(1, 3, 4), KC_H);
+}
+
+TEST_F(DynamicKeymapRamCache, flush_writes_immediately) {
+    uint16_t before = stored_keycode(3, 0, 5);
+    dynamic_keymap_set_keycode(3, 0, 5, KC_F);
+    EXPECT_EQ(stored_keycode(3, 0, 5), before);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(stored_keycode(3, 0, 5), KC_F);
+}
+
+TEST_F(DynamicKeymapRamCache, reset_rewrites_formatted_eeprom) {
+    // Cache the keymap as flashed, then change EEPROM behind its back as a format would
+    dynamic_keymap_reset();
+    uint8_t erased[2] = {0xFF, 0xFF};
+    eeprom_update_block(erased, dynamic_keymap_key_to_eeprom_address(0, 0, 0), sizeof(erased));
+    ASSERT_NE(stored_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0));
+
+    dynamic_keymap_reset();
+    EXPECT_EQ(stored_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0));
+}
+
+TEST_F(DynamicKeymapRamCache, suspend_flushes_pending_writes) {
+    uint16_t before = stored_keycode(2, 1, 1);
+    dynamic_keymap_set_keycode(2, 1, 1, KC_G);
+    EXPECT_EQ(stored_keycode(2, 1, 1), before);
+
+    suspend_power_down_quantum();
+    EXPECT_EQ(stored_keycode(2, 1, 1), KC_G);
+}
@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DYNAMIC_KEYMAP_ENABLE = yes
+
+# Goes through the generic EEPROM driver layer, like real hardware, and counts reads
+EEPROM_DRIVER = custom
+
+SRC += counting_eeprom.c
@@ -0,0 +1,138 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "keymap_introspection.h"
+#include "counting_eeprom.h"
+}
+
+class DynamicKeymap : public TestFixture {
+   public:
+    // Keycode as currently stored in EEPROM, bypassing any caching
+    uint16_t stored_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+
+    // Average cost of resolving a keycode, cycling over every key of every layer
+    double lookup_ns(int iterations) {
+        volatile uint16_t sink = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            uint8_t layer  = i % dynamic_keymap_get_layer_count();
+            uint8_t row    = (i / 4) % MATRIX_ROWS;
+            uint8_t column = (i / 16) % MATRIX_COLS;
+            sink           = sink + dynamic_keymap_get_keycode(layer, row, column);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+};
+
+TEST_F(DynamicKeymap, set_keycode_is_read_back) {
+    dynamic_keymap_set_keycode(1, 2, 3, KC_A);
+    dynamic_keymap_set_keycode(3, 3, 9, QK_BOOT);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 3, 9), QK_BOOT);
+    EXPECT_EQ(keycode_at_keymap_location(1, 2, 3), KC_A);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(stored_keycode(1, 2, 3), KC_A);
+    EXPECT_EQ(stored_keycode(3, 3, 9), QK_BOOT);
+}
+
+TEST_F(DynamicKeymap, out_of_range_is_ignored) {
+    dynamic_keymap_set_keycode(dynamic_keymap_get_layer_count(), 0, 0, KC_A);
+    dynamic_keymap_set_keycode(0, MATRIX_ROWS, 0, KC_A);
+    dynamic_keymap_set_keycode(0, 0, MATRIX_COLS, KC_A);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(dynamic_keymap_get_layer_count(), 0, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS), KC_NO);
+}
+
+TEST_F(DynamicKeymap, buffer_is_big_endian) {
+    dynamic_keymap_set_keycode(0, 0, 1, 0x1234);
+
+    uint8_t data[4] = {0};
+    dynamic_keymap_get_buffer(2, sizeof(data), data);
+    EXPECT_EQ(data[0], 0x12);
+    EXPECT_EQ(data[1], 0x34);
+
+    // Writes may start on either byte of a keycode
+    uint8_t update[3] = {0xAB, 0x56, 0x78};
+    dynamic_keymap_set_buffer(3, sizeof(update), update);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0x12AB);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 2), 0x5678);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(stored_keycode(0, 0, 1), 0x12AB);
+    EXPECT_EQ(stored_keycode(0, 0, 2), 0x5678);
+}
+
+TEST_F(DynamicKeymap, buffer_past_the_keymap_reads_zero) {
+    uint16_t keymap_size = dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+
+    uint8_t data[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+    dynamic_keymap_set_buffer(keymap_size, sizeof(data), data);
+    dynamic_keymap_get_buffer(keymap_size - 2, sizeof(data), data);
+    EXPECT_EQ(data[2], 0x00);
+    EXPECT_EQ(data[3], 0x00);
+}
+
+TEST_F(DynamicKeymap, reset_restores_keymap_and_persists_it) {
+    dynamic_keymap_set_keycode(0, 1, 1, KC_B);
+    dynamic_keymap_set_keycode(2, 1, 1, KC_B);
+    dynamic_keymap_reset();
+
+    // Layers missing from the static keymap are reset to KC_TRNS
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 1, 1), KC_TRNS);
+    EXPECT_EQ(stored_keycode(0, 1, 1), KC_NO);
+    EXPECT_EQ(stored_keycode(2, 1, 1), KC_TRNS);
+}
+
+TEST_F(DynamicKeymap, eeprom_reads_per_lookup) {
+    // Loads the cache, if there is one
+    dynamic_keymap_get_keycode(0, 0, 0);
+
+    const uint32_t lookups = dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS;
+    counting_eeprom_reads  = 0;
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); ++layer) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t column = 0; column < MATRIX_COLS; ++column) {
+                dynamic_keymap_get_keycode(layer, row, column);
+                keycode_at_keymap_location(layer, row, column);
+            }
+        }
+    }
+    printf("[ COUNT    ] %.1f EEPROM reads per lookup\n", counting_eeprom_reads / (2.0 * lookups));
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    EXPECT_EQ(counting_eeprom_reads, 0u);
+#else
+    // One read per byte of the big endian keycode
+    EXPECT_EQ(counting_eeprom_reads, 2 * 2 * lookups);
+#endif
+}
+
+TEST_F(DynamicKeymap, benchmark) {
+    printf("[ BENCHMARK] dynamic_keymap_get_keycode: %.1f ns/lookup (%s)\n", lookup_ns(200000),
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+           "RAM cache"
+#else
+           "EEPROM"
+#endif
+    );
+}
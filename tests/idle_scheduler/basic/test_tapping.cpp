@@ -0,0 +1,5 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Must produce the same reports when the scheduler skips idle passes
+#include "../../basic/test_tapping.cpp"
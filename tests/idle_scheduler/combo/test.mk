@@ -0,0 +1,7 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+IDLE_SCHEDULER_ENABLE = yes
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_combos.c
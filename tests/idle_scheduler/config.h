@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Rely on the matrix waking the scheduler, as a keyboard with pin change interrupts would
+#define IDLE_SCHEDULER_SCAN_INTERVAL 50
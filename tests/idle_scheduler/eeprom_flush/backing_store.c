@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Backing store kept in RAM, counting the writes that reach it.
+
+#include <string.h>
+#include "wear_leveling.h"
+#include "wear_leveling_internal.h"
+
+static backing_store_int_t backing_store[WEAR_LEVELING_BACKING_SIZE / BACKING_STORE_WRITE_SIZE];
+uint32_t                   backing_store_writes = 0;
+
+bool backing_store_init(void) {
+    return true;
+}
+
+bool backing_store_unlock(void) {
+    return true;
+}
+
+bool backing_store_erase(void) {
+    memset(backing_store, 0x00, sizeof(backing_store));
+    return true;
+}
+
+bool backing_store_write(uint32_t address, backing_store_int_t value) {
+    backing_store[address / BACKING_STORE_WRITE_SIZE] = value;
+    backing_store_writes++;
+    return true;
+}
+
+bool backing_store_lock(void) {
+    return true;
+}
+
+bool backing_store_read(uint32_t address, backing_store_int_t *value) {
+    *value = backing_store[address / BACKING_STORE_WRITE_SIZE];
+    return true;
+}
@@ -0,0 +1,14 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define IDLE_SCHEDULER_SCAN_INTERVAL 50
+
+#define BACKING_STORE_WRITE_SIZE 4
+#define WEAR_LEVELING_BACKING_SIZE 4096
+#define WEAR_LEVELING_LOGICAL_SIZE 1024
+#define WEAR_LEVELING_FLUSH_DELAY 120
+#define WEAR_LEVELING_FLUSH_MAX_DELAY 500
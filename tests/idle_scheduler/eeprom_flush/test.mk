@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+IDLE_SCHEDULER_ENABLE = yes
+
+EEPROM_DRIVER = wear_leveling
+WEAR_LEVELING_DRIVER = custom
+
+SRC += backing_store.c
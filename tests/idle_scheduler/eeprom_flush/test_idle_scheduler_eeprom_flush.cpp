@@ -0,0 +1,64 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "idle_scheduler.h"
+#include "timer.h"
+
+extern uint32_t backing_store_writes;
+}
+
+class IdleSchedulerEepromFlush : public TestFixture {
+   public:
+    // The fixture writes EEPROM before keyboard_init() gets to set up wear leveling
+    static void SetUpTestCase() {
+        eeprom_driver_init();
+        TestFixture::SetUpTestCase();
+    }
+
+    IdleSchedulerEepromFlush() {
+        eeprom_driver_flush();
+        backing_store_writes = 0;
+    }
+};
+
+TEST_F(IdleSchedulerEepromFlush, flush_runs_when_writes_stop) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    eeprom_update_byte((uint8_t *)10, 0x5A);
+    run_one_scan_loop();
+    ASSERT_TRUE(eeprom_driver_flush_pending());
+
+    // The scheduler wakes for the deadline, well before the next scan interval would end
+    uint32_t written = timer_read32();
+    while (eeprom_driver_flush_pending() && timer_elapsed32(written) < WEAR_LEVELING_FLUSH_DELAY + IDLE_SCHEDULER_SCAN_INTERVAL) {
+        run_one_scan_loop();
+    }
+    EXPECT_FALSE(eeprom_driver_flush_pending());
+    EXPECT_LE(timer_elapsed32(written), WEAR_LEVELING_FLUSH_DELAY + 1);
+    EXPECT_GT(backing_store_writes, 0u);
+    EXPECT_EQ(eeprom_read_byte((uint8_t *)10), 0x5A);
+}
+
+TEST_F(IdleSchedulerEepromFlush, steady_writes_flush_by_the_max_delay) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint32_t first = timer_read32();
+    uint8_t  value = 0;
+    // Keep writing more often than the flush delay
+    while (timer_elapsed32(first) < WEAR_LEVELING_FLUSH_MAX_DELAY + IDLE_SCHEDULER_SCAN_INTERVAL && (value == 0 || eeprom_driver_flush_pending())) {
+        eeprom_update_byte((uint8_t *)20, ++value);
+        idle_for(WEAR_LEVELING_FLUSH_DELAY / 2);
+    }
+    EXPECT_FALSE(eeprom_driver_flush_pending());
+    EXPECT_LE(timer_elapsed32(first), WEAR_LEVELING_FLUSH_MAX_DELAY + WEAR_LEVELING_FLUSH_DELAY / 2);
+}
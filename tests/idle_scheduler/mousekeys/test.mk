@@ -0,0 +1,5 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+IDLE_SCHEDULER_ENABLE = yes
+MOUSEKEY_ENABLE = yes
@@ -0,0 +1,5 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The mouse key tests must produce the same reports when the scheduler skips idle passes
+#include "../../mousekeys/test_mousekeys.cpp"
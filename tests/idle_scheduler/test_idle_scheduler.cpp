@@ -0,0 +1,140 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "deferred_exec.h"
+#include "idle_scheduler.h"
+
+static unsigned pass_count = 0;
+
+void housekeeping_task_user(void) {
+    pass_count++;
+    deferred_exec_task();
+}
+}
+
+class IdleScheduler : public TestFixture {
+   public:
+    IdleScheduler() {
+        pass_count = 0;
+    }
+};
+
+TEST_F(IdleScheduler, idle_keyboard_runs_once_per_scan_interval) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    idle_for(IDLE_SCHEDULER_SCAN_INTERVAL * 10);
+    EXPECT_EQ(pass_count, 10);
+}
+
+TEST_F(IdleScheduler, key_press_wakes_the_scheduler) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    idle_for(IDLE_SCHEDULER_SCAN_INTERVAL / 2);
+    pass_count = 0;
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(pass_count, 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, matrix_change_keeps_scanning_until_debounced) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    pass_count = 0;
+    idle_for(IDLE_SCHEDULER_DEBOUNCE_WINDOW + 1);
+    EXPECT_EQ(pass_count, IDLE_SCHEDULER_DEBOUNCE_WINDOW + 1);
+
+    pass_count = 0;
+    idle_for(IDLE_SCHEDULER_SCAN_INTERVAL);
+    EXPECT_EQ(pass_count, 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, tapping_term_expiry_wakes_the_scheduler) {
+    TestDriver driver;
+    KeymapKey  mod_tap_key(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    // The busy loop would have sent the hold on this very pass
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, tapping_key_waits_less_than_a_busy_loop) {
+    TestDriver driver;
+    KeymapKey  mod_tap_key(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    mod_tap_key.press();
+    pass_count = 0;
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_LT(pass_count, (unsigned)TAPPING_TERM / 4);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+static uint32_t callback_time = 0;
+
+static uint32_t record_callback_time(uint32_t trigger_time, void *cb_arg) {
+    callback_time = timer_read32();
+    return 0;
+}
+
+TEST_F(IdleScheduler, deferred_executor_wakes_the_scheduler) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    run_one_scan_loop();
+    uint32_t start = timer_read32();
+    callback_time  = 0;
+    ASSERT_NE(defer_exec(123, record_callback_time, NULL), INVALID_DEFERRED_TOKEN);
+
+    // The scheduler only learns about the executor on the next pass
+    pass_count = 0;
+    idle_for(IDLE_SCHEDULER_SCAN_INTERVAL * 4);
+    EXPECT_EQ(callback_time, start + 123);
+    EXPECT_LE(pass_count, 5);
+}
@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define IDLE_SCHEDULER_SCAN_INTERVAL 50
+
+// None of these are multiples of the scan interval
+#define TAPPING_TERM 180
+#define ONESHOT_TIMEOUT 120
+#define CAPS_WORD_IDLE_TIMEOUT 130
+#define LEADER_TIMEOUT 160
+#define AUTO_SHIFT_TIMEOUT 170
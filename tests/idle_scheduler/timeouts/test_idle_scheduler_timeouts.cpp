@@ -0,0 +1,105 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "idle_scheduler.h"
+
+static unsigned wake_init_calls = 0;
+
+void idle_scheduler_wake_init_kb(void) {
+    wake_init_calls++;
+}
+}
+
+// Each timeout must be acted on when it expires, not at the next scan interval
+class IdleSchedulerTimeouts : public TestFixture {};
+
+TEST_F(IdleSchedulerTimeouts, wake_init_hook_runs_once) {
+    EXPECT_EQ(wake_init_calls, 1);
+}
+
+TEST_F(IdleSchedulerTimeouts, one_shot_timeout_wakes_the_scheduler) {
+    TestDriver driver;
+    KeymapKey  osm_key(0, 0, 0, OSM(MOD_LSFT));
+    set_keymap({osm_key});
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    tap_key(osm_key);
+    idle_for(ONESHOT_TIMEOUT - 3);
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LEFT_SHIFT));
+    idle_for(4);
+    EXPECT_EQ(get_oneshot_mods(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSchedulerTimeouts, tap_dance_term_wakes_the_scheduler) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  td_key(0, 0, 0, TD(0));
+    set_keymap({td_key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(td_key);
+    idle_for(TAPPING_TERM - 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSchedulerTimeouts, caps_word_timeout_wakes_the_scheduler) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    caps_word_on();
+    idle_for(CAPS_WORD_IDLE_TIMEOUT - 1);
+    EXPECT_TRUE(is_caps_word_on());
+    idle_for(2);
+    EXPECT_FALSE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSchedulerTimeouts, leader_timeout_wakes_the_scheduler) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    leader_start();
+    idle_for(LEADER_TIMEOUT);
+    EXPECT_TRUE(leader_sequence_active());
+    idle_for(2);
+    EXPECT_FALSE(leader_sequence_active());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSchedulerTimeouts, auto_shift_timeout_wakes_the_scheduler) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    idle_for(AUTO_SHIFT_TIMEOUT - 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
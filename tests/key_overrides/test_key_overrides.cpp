@@ -0,0 +1,219 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "quantum.h"
+#include "keymap_introspection.h"
+
+static uint32_t overrides_visited;
+
+// Every override process_key_override() looks at goes through here
+const key_override_t *key_override_get(uint16_t key_override_idx) {
+    ++overrides_visited;
+    return key_override_get_raw(key_override_idx);
+}
+}
+
+class KeyOverrides : public TestFixture {
+   public:
+    // Average cost of running a press and release through
+    // process_key_override(), with the given mods held.
+    double process_key_override_ns(uint16_t keycode, uint8_t mods, int iterations) {
+        keyrecord_t record = {};
+        record.event.key   = {.col = 0, .row = 0};
+        record.event.type  = KEY_EVENT;
+
+        set_mods(mods);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            record.event.pressed = !(i & 1);
+            process_key_override(keycode, &record);
+        }
+        auto end = std::chrono::steady_clock::now();
+        clear_mods();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    // Overrides looked at for a press and release, with the given mods held
+    uint32_t overrides_visited_per_tap(uint16_t keycode, uint8_t mods) {
+        keyrecord_t record = {};
+        record.event.key   = {.col = 0, .row = 0};
+        record.event.type  = KEY_EVENT;
+
+        set_mods(mods);
+        overrides_visited = 0;
+        for (bool pressed : {true, false}) {
+            record.event.pressed = pressed;
+            process_key_override(keycode, &record);
+        }
+        clear_mods();
+        return overrides_visited;
+    }
+};
+
+TEST_F(KeyOverrides, key_without_mods_is_sent) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_BACKSPACE);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, trigger_with_mods_is_replaced) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LEFT_SHIFT);
+    KeymapKey  key(0, 1, 0, KC_BACKSPACE);
+    set_keymap({key_shift, key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DELETE));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    tap_key(key);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, first_matching_override_wins) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LEFT_SHIFT);
+    KeymapKey  key(0, 1, 0, KC_COMMA);
+    set_keymap({key_shift, key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_SEMICOLON));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    tap_key(key);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, mod_pressed_after_trigger_activates) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LEFT_SHIFT);
+    KeymapKey  key(0, 1, 0, KC_BACKSPACE);
+    set_keymap({key_shift, key});
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE));
+    key.press();
+    run_one_scan_loop();
+
+    // The replacement follows after the key repeat delay
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_DELETE));
+    key_shift.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key.release();
+    key_shift.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, override_without_trigger_activates_on_mods) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LEFT_CTRL);
+    KeymapKey  key_alt(0, 1, 0, KC_LEFT_ALT);
+    set_keymap({key_ctrl, key_alt});
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    key_ctrl.press();
+    run_one_scan_loop();
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    key_alt.press();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_alt.release();
+    key_ctrl.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, overrides_visited_per_event) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    struct {
+        const char *name;
+        uint16_t    keycode;
+        uint8_t     mods;
+    } events[] = {
+        {"KC_A", KC_A, 0},
+        {"KC_7", KC_7, 0},
+        {"LSFT+KC_A", KC_A, MOD_BIT(KC_LEFT_SHIFT)},
+        {"LSFT+KC_7", KC_7, MOD_BIT(KC_LEFT_SHIFT)},
+    };
+
+    ASSERT_GE(key_override_count(), 100);
+    for (auto &event : events) {
+        uint32_t visited = overrides_visited_per_tap(event.keycode, event.mods);
+        printf("[ COUNT    ] process_key_override %u overrides %-10s %3u visited per tap\n", key_override_count(), event.name, (unsigned)visited);
+        // Only the overrides for the key, and the lookups to find them, instead of every override on the press and the release
+        EXPECT_LT(visited, key_override_count() / 2u) << event.name;
+    }
+}
+
+TEST_F(KeyOverrides, benchmark) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    // Best of several runs, to keep the noise of the host out
+    const int iterations = 100000;
+    const int runs       = 10;
+
+    struct {
+        const char *name;
+        uint16_t    keycode;
+        uint8_t     mods;
+    } events[] = {
+        {"KC_A", KC_A, 0},
+        {"KC_7", KC_7, 0},
+        {"LSFT+KC_A", KC_A, MOD_BIT(KC_LEFT_SHIFT)},
+        {"LSFT+KC_7", KC_7, MOD_BIT(KC_LEFT_SHIFT)},
+    };
+
+    for (auto &event : events) {
+        double ns = process_key_override_ns(event.keycode, event.mods, iterations);
+        for (int run = 1; run < runs; ++run) {
+            ns = std::min(ns, process_key_override_ns(event.keycode, event.mods, iterations));
+        }
+        printf("[ BENCHMARK] process_key_override %u overrides %-10s %6.1f ns/event\n", key_override_count(), event.name, ns);
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const key_override_t shift_backspace_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+const key_override_t shift_comma_override     = ko_make_basic(MOD_MASK_SHIFT, KC_COMMA, KC_SEMICOLON);
+const key_override_t shift_comma_shadowed     = ko_make_basic(MOD_MASK_SHIFT, KC_COMMA, KC_QUOTE);
+const key_override_t ctrl_alt_override        = ko_make_basic(MOD_BIT(KC_LEFT_CTRL) | MOD_BIT(KC_LEFT_ALT), KC_NO, KC_ESCAPE);
+
+// Overrides that never fire in the tests, to give the lookup something to
+// skip: KC_A to KC_6 with each of four pairs of Alt and GUI.
+// clang-format off
+#define FILLER_KEYS(mods) { \
+    ko_make_basic(mods, KC_A, KC_NO), ko_make_basic(mods, KC_B, KC_NO), ko_make_basic(mods, KC_C, KC_NO), ko_make_basic(mods, KC_D, KC_NO), \
+    ko_make_basic(mods, KC_E, KC_NO), ko_make_basic(mods, KC_F, KC_NO), ko_make_basic(mods, KC_G, KC_NO), ko_make_basic(mods, KC_H, KC_NO), \
+    ko_make_basic(mods, KC_I, KC_NO), ko_make_basic(mods, KC_J, KC_NO), ko_make_basic(mods, KC_K, KC_NO), ko_make_basic(mods, KC_L, KC_NO), \
+    ko_make_basic(mods, KC_M, KC_NO), ko_make_basic(mods, KC_N, KC_NO), ko_make_basic(mods, KC_O, KC_NO), ko_make_basic(mods, KC_P, KC_NO), \
+    ko_make_basic(mods, KC_Q, KC_NO), ko_make_basic(mods, KC_R, KC_NO), ko_make_basic(mods, KC_S, KC_NO), ko_make_basic(mods, KC_T, KC_NO), \
+    ko_make_basic(mods, KC_U, KC_NO), ko_make_basic(mods, KC_V, KC_NO), ko_make_basic(mods, KC_W, KC_NO), ko_make_basic(mods, KC_X, KC_NO), \
+    ko_make_basic(mods, KC_Y, KC_NO), ko_make_basic(mods, KC_Z, KC_NO), ko_make_basic(mods, KC_1, KC_NO), ko_make_basic(mods, KC_2, KC_NO), \
+    ko_make_basic(mods, KC_3, KC_NO), ko_make_basic(mods, KC_4, KC_NO), ko_make_basic(mods, KC_5, KC_NO), ko_make_basic(mods, KC_6, KC_NO), \
+}
+
+#define FILLER_POINTERS(array) \
+    &array[0],  &array[1],  &array[2],  &array[3],  &array[4],  &array[5],  &array[6],  &array[7], \
+    &array[8],  &array[9],  &array[10], &array[11], &array[12], &array[13], &array[14], &array[15], \
+    &array[16], &array[17], &array[18], &array[19], &array[20], &array[21], &array[22], &array[23], \
+    &array[24], &array[25], &array[26], &array[27], &array[28], &array[29], &array[30], &array[31]
+
+const key_override_t alt_gui_overrides[]   = FILLER_KEYS(MOD_BIT(KC_LEFT_ALT) | MOD_BIT(KC_LEFT_GUI));
+const key_override_t ralt_gui_overrides[]  = FILLER_KEYS(MOD_BIT(KC_RIGHT_ALT) | MOD_BIT(KC_LEFT_GUI));
+const key_override_t alt_rgui_overrides[]  = FILLER_KEYS(MOD_BIT(KC_LEFT_ALT) | MOD_BIT(KC_RIGHT_GUI));
+const key_override_t ralt_rgui_overrides[] = FILLER_KEYS(MOD_BIT(KC_RIGHT_ALT) | MOD_BIT(KC_RIGHT_GUI));
+
+const key_override_t *key_overrides[] = {
+    FILLER_POINTERS(alt_gui_overrides),
+    FILLER_POINTERS(ralt_gui_overrides),
+    &shift_comma_override,
+    &shift_backspace_override,
+    FILLER_POINTERS(alt_rgui_overrides),
+    &ctrl_alt_override,
+    &shift_comma_shadowed,
+    FILLER_POINTERS(ralt_rgui_overrides),
+};
+// clang-format on
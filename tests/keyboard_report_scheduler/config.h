@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define KEYBOARD_REPORT_SCHEDULER
+#define KEYBOARD_REPORT_QUEUE_SIZE 4
+#define USB_POLLING_INTERVAL_MS 4
@@ -0,0 +1,185 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// Reports are sent from the pass of the main loop that runs once the interval
+// has passed; idle_for(n) runs passes at the current time and the n - 1 after.
+class KeyboardReportScheduler : public TestFixture {
+   public:
+    void SetUp() override {
+        stats = host_keyboard_report_stats();
+    }
+
+    host_keyboard_report_stats_t stats;
+
+    uint16_t merged() {
+        return host_keyboard_report_stats().merged - stats.merged;
+    }
+};
+
+TEST_F(KeyboardReportScheduler, first_report_is_sent_straight_away) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    register_code(KC_A);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    unregister_code(KC_A);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, burst_is_paced_to_polling_interval) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    tap_code(KC_A);
+    tap_code(KC_A);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(host_keyboard_report_pending());
+
+    // Merging the release into the second press would lose a tap, so every report goes through
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(USB_POLLING_INTERVAL_MS + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(USB_POLLING_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    EXPECT_FALSE(host_keyboard_report_pending());
+    EXPECT_EQ(merged(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, release_and_modifier_merge_into_next_press) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    register_code(KC_A);
+    VERIFY_AND_CLEAR(driver);
+
+    // Releasing A, then holding shift, then pressing B can be seen all at once
+    unregister_code(KC_A);
+    register_code(KC_LEFT_SHIFT);
+    register_code(KC_B);
+    EXPECT_EQ(merged(), 2);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    idle_for(USB_POLLING_INTERVAL_MS + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_keyboard();
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, press_is_not_merged_into_modifier_change) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    register_code(KC_LEFT_SHIFT);
+    VERIFY_AND_CLEAR(driver);
+
+    // A is typed shifted, so it must reach the host before shift is released
+    register_code(KC_A);
+    unregister_code(KC_LEFT_SHIFT);
+    EXPECT_EQ(merged(), 0);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(2 * USB_POLLING_INTERVAL_MS + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    unregister_code(KC_A);
+    idle_for(USB_POLLING_INTERVAL_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, full_queue_sends_early_without_losing_reports) {
+    TestDriver driver;
+    InSequence s;
+
+    // Ten reports that cannot be merged, more than the queue holds
+    for (int i = 0; i < 5; i++) {
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    for (int i = 0; i < 5; i++) {
+        tap_code(KC_A);
+    }
+    host_keyboard_report_flush();
+    EXPECT_FALSE(host_keyboard_report_pending());
+    EXPECT_EQ(merged(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, release_merges_into_next_press) {
+    TestDriver driver;
+    InSequence s;
+
+    // Typing "abc" needs only one report per key
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_code(KC_A);
+    tap_code(KC_B);
+    tap_code(KC_C);
+    host_keyboard_report_flush();
+    EXPECT_EQ(merged(), 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardReportScheduler, other_reports_wait_for_queued_keyboard_reports) {
+    TestDriver driver;
+    InSequence s;
+
+    // The clock restarts for each test, so let the last report's interval pass
+    idle_for(USB_POLLING_INTERVAL_MS);
+
+    EXPECT_REPORT(driver, (KC_A));
+    tap_code(KC_A);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(host_keyboard_report_pending());
+
+    // The release of A was made first, so the host must see it first
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_extra_mock(_));
+    host_consumer_send(AUDIO_VOL_UP);
+    EXPECT_FALSE(host_keyboard_report_pending());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_ANY_MOUSE_REPORT(driver);
+    tap_code(KC_A);
+    report_mouse_t mouse_report = {.x = 1};
+    host_mouse_send(&mouse_report);
+    EXPECT_FALSE(host_keyboard_report_pending());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_extra_mock(_));
+    host_consumer_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiler.h"
+#include "latency_trace.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTrace : public TestFixture {
+   public:
+    void SetUp() override {
+        profiler_reset();
+    }
+
+    const profiler_zone_stats_t *zone(const char *name) {
+        return profiler_get_zone(profiler_find_zone(name));
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsReportedWithoutQueueing) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_NE(zone("key_latency"), nullptr);
+    EXPECT_EQ(zone("key_latency")->count, 2);
+    EXPECT_EQ(zone("key_latency")->max, 0);
+    EXPECT_EQ(zone("latency_queue")->count, 2);
+    EXPECT_EQ(zone("latency_queue")->max, 0);
+    EXPECT_EQ(zone("latency_process")->count, 2);
+    EXPECT_EQ(zone("latency_debounce")->parent, profiler_find_zone("key_latency"));
+}
+
+TEST_F(LatencyTrace, TappingBufferTimeIsAttributedToQueue) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    mod_tap_key.press();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM - 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The press waited in the tapping buffer until the release resolved it
+    EXPECT_EQ(zone("latency_queue")->max, TAPPING_TERM - 10);
+    EXPECT_EQ(zone("key_latency")->max, TAPPING_TERM - 10);
+    EXPECT_EQ(zone("latency_process")->max, 0);
+}
+
+TEST_F(LatencyTrace, DebounceTimeIsMeasuredFromRawEdge) {
+    TestDriver         driver;
+    const matrix_row_t cooked[MATRIX_ROWS] = {0};
+    matrix_row_t       raw[MATRIX_ROWS]    = {0};
+
+    // A bounce that settles back is forgotten
+    raw[1] = 1 << 2;
+    latency_trace_raw_scan(raw, cooked, 0, MATRIX_ROWS);
+    idle_for(3);
+    raw[1] = 0;
+    latency_trace_raw_scan(raw, cooked, 0, MATRIX_ROWS);
+
+    raw[1] = 1 << 2;
+    latency_trace_raw_scan(raw, cooked, 0, MATRIX_ROWS);
+    idle_for(5);
+    latency_trace_raw_scan(raw, cooked, 0, MATRIX_ROWS);
+    latency_trace_capture(1, 2);
+
+    EXPECT_EQ(zone("latency_debounce")->count, 1);
+    EXPECT_EQ(zone("latency_debounce")->max, 5);
+}
@@ -0,0 +1,109 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+class LayerTransparencyMask : public TestFixture {
+   public:
+    // Fills every position of every layer, with roughly `transparent_percent`
+    // of them set to KC_TRNS.
+    void add_random_keymap(std::mt19937 &rng, unsigned transparent_percent) {
+        std::uniform_int_distribution<unsigned> percent(0, 99);
+        std::uniform_int_distribution<uint16_t> keycode(KC_A, KC_Z);
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    add_key(KeymapKey(layer, col, row, percent(rng) < transparent_percent ? KC_TRNS : keycode(rng)));
+                }
+            }
+        }
+        layer_transparency_mask_rebuild();
+    }
+
+    // The layer walk the mask replaces
+    uint8_t walk_layers(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void expect_walk_equivalence(std::mt19937 &rng, unsigned iterations) {
+        std::uniform_int_distribution<layer_state_t> state;
+        std::uniform_int_distribution<uint8_t>       layer(0, MAX_LAYER - 1);
+        for (unsigned i = 0; i < iterations; i++) {
+            // Sparse states are the common case, dense ones exercise the fallback
+            layer_state         = (i & 1) ? state(rng) : ((layer_state_t)1 << layer(rng)) | ((layer_state_t)1 << layer(rng));
+            default_layer_state = (layer_state_t)1 << layer(rng);
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    keypos_t key = {.col = col, .row = row};
+                    ASSERT_EQ(layer_switch_get_layer(key), walk_layers(key)) << "layer_state " << layer_state << " default_layer_state " << default_layer_state << " at (" << +col << "," << +row << ")";
+                }
+            }
+        }
+        layer_state         = 0;
+        default_layer_state = 1;
+    }
+};
+
+TEST_F(LayerTransparencyMask, matches_walk_on_mostly_transparent_keymap) {
+    std::mt19937 rng(1);
+    add_random_keymap(rng, 90);
+    expect_walk_equivalence(rng, 2000);
+}
+
+TEST_F(LayerTransparencyMask, matches_walk_on_mostly_opaque_keymap) {
+    std::mt19937 rng(2);
+    add_random_keymap(rng, 10);
+    expect_walk_equivalence(rng, 2000);
+}
+
+TEST_F(LayerTransparencyMask, matches_walk_on_fully_transparent_keymap) {
+    std::mt19937 rng(3);
+    add_random_keymap(rng, 100);
+    expect_walk_equivalence(rng, 200);
+}
+
+TEST_F(LayerTransparencyMask, transparent_key_falls_through_to_lower_layer) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(5, 0, 0, KC_B);
+    KeymapKey  key_trns(31, 0, 0, KC_TRNS);
+    set_keymap({key_a, key_b, key_trns});
+    for (uint8_t layer = 1; layer < MAX_LAYER; layer++) {
+        if (layer != 5 && layer != 31) {
+            add_key(KeymapKey(layer, 0, 0, KC_TRNS));
+        }
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+                if (row != 0 || col != 0) {
+                    add_key(KeymapKey(layer, col, row, KC_NO));
+                }
+            }
+        }
+    }
+    layer_transparency_mask_rebuild();
+
+    layer_on(31);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    layer_on(5);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+}
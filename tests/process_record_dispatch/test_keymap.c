@@ -0,0 +1,19 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_X, KC_Y),
+};
+
+const key_override_t ctrl_backspace_override = ko_make_basic(MOD_MASK_CTRL, KC_BACKSPACE, KC_DELETE);
+
+const key_override_t *key_overrides[] = {
+    &ctrl_backspace_override,
+};
+
+// Steno sends its chords over the virtual serial port, which the host lacks
+void virtser_init(void) {}
+
+void virtser_send(const uint8_t byte) {}
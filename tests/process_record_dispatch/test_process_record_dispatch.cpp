@@ -0,0 +1,126 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "quantum.h"
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   public:
+    // Average cost of running an event through process_record_quantum(),
+    // which stops short of the action itself. The keycode is set on the
+    // record, as Repeat Key does, to leave the keymap lookup out.
+    double process_record_ns(uint16_t keycode, int iterations) {
+        keyrecord_t record = {};
+        record.event.key   = {.col = 0, .row = 0};
+        record.event.type  = KEY_EVENT;
+        record.keycode     = keycode;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            record.event.pressed = !(i & 1);
+            process_record_quantum(&record);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    // Handlers called and skipped for a press and release of keycode
+    process_record_handler_stats_t handlers_per_tap(uint16_t keycode) {
+        keyrecord_t record = {};
+        record.event.key   = {.col = 0, .row = 0};
+        record.event.type  = KEY_EVENT;
+        record.keycode     = keycode;
+
+        process_record_clear_handler_stats();
+        for (bool pressed : {true, false}) {
+            record.event.pressed = pressed;
+            process_record_quantum(&record);
+        }
+        return process_record_get_handler_stats();
+    }
+};
+
+TEST_F(ProcessRecordDispatch, basic_key_is_sent) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, ranged_handler_still_runs) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, QK_GRAVE_ESCAPE);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, handler_for_every_event_sees_basic_keys) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_repeat(0, 1, 0, QK_REPEAT_KEY);
+    set_keymap({key_a, key_repeat});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(2);
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_key(key_a);
+    tap_key(key_repeat);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, basic_keys_skip_ranged_handlers) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    process_record_handler_stats_t basic   = handlers_per_tap(KC_A);
+    process_record_handler_stats_t mod_tap = handlers_per_tap(LCTL_T(KC_A));
+    process_record_handler_stats_t user    = handlers_per_tap(QK_USER);
+    printf("[ COUNT    ] process_record_quantum handlers called per tap: KC_A %u of %u, LCTL_T(KC_A) %u of %u, QK_USER %u of %u\n", (unsigned)basic.called, (unsigned)(basic.called + basic.skipped), (unsigned)mod_tap.called, (unsigned)(mod_tap.called + mod_tap.skipped), (unsigned)user.called, (unsigned)(user.called + user.skipped));
+
+    // Only the handlers for every keycode see basic keys and mod-taps
+    EXPECT_GT(basic.skipped, basic.called / 2);
+    EXPECT_EQ(mod_tap.called, basic.called);
+    EXPECT_EQ(mod_tap.skipped, basic.skipped);
+    // A key that goes through the whole chain passes every handler once per event
+    EXPECT_EQ(user.called + user.skipped, basic.called + basic.skipped);
+}
+
+TEST_F(ProcessRecordDispatch, benchmark) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    // Best of several runs, to keep the noise of the host out
+    const int iterations = 200000;
+    const int runs       = 10;
+
+    struct {
+        const char *name;
+        uint16_t    keycode;
+    } keys[] = {{"KC_A", KC_A}, {"LCTL_T(KC_A)", LCTL_T(KC_A)}, {"QK_USER", QK_USER}};
+
+    for (auto &key : keys) {
+        double ns = process_record_ns(key.keycode, iterations);
+        for (int run = 1; run < runs; ++run) {
+            ns = std::min(ns, process_record_ns(key.keycode, iterations));
+        }
+        printf("[ BENCHMARK] process_record_quantum %-12s %6.1f ns/event\n", key.name, ns);
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiler.h"
+void simulate_async_tick(uint32_t t);
+}
+
+using testing::_;
+
+class Profiler : public TestFixture {};
+
+TEST_F(Profiler, KeyboardTaskZonesAreRegistered) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    profiler_zone_id_t keyboard_task = profiler_find_zone("keyboard_task");
+    profiler_zone_id_t matrix_task   = profiler_find_zone("matrix_task");
+    profiler_zone_id_t quantum_task  = profiler_find_zone("quantum_task");
+    ASSERT_NE(keyboard_task, PROFILER_ZONE_INVALID);
+    ASSERT_NE(matrix_task, PROFILER_ZONE_INVALID);
+    ASSERT_NE(quantum_task, PROFILER_ZONE_INVALID);
+
+    EXPECT_EQ(profiler_get_zone(matrix_task)->parent, keyboard_task);
+    EXPECT_EQ(profiler_get_zone(quantum_task)->parent, keyboard_task);
+    EXPECT_GT(profiler_get_zone(keyboard_task)->count, 0);
+}
+
+TEST_F(Profiler, SimulatedClockDrivesDurations) {
+    TestDriver driver;
+
+    profiler_reset();
+    // Every timer read inside the scan loop advances the simulated clock
+    simulate_async_tick(1);
+    run_one_scan_loop();
+    simulate_async_tick(0);
+
+    profiler_zone_id_t keyboard_task = profiler_find_zone("keyboard_task");
+    profiler_zone_id_t matrix_task   = profiler_find_zone("matrix_task");
+    ASSERT_NE(keyboard_task, PROFILER_ZONE_INVALID);
+    ASSERT_NE(matrix_task, PROFILER_ZONE_INVALID);
+    EXPECT_EQ(profiler_get_zone(keyboard_task)->count, 1);
+    EXPECT_GT(profiler_get_zone(keyboard_task)->max, profiler_get_zone(matrix_task)->max);
+}
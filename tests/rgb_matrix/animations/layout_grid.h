@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// One LED per key, spread evenly over the whole 224x64 area, with the bottom row as modifiers.
+// Needs RGB_MATRIX_LED_COUNT set to MATRIX_ROWS * MATRIX_COLS.
+
+#pragma once
+
+// clang-format off
+#define LED_ROW(r) r * MATRIX_COLS + 0, r * MATRIX_COLS + 1, r * MATRIX_COLS + 2, r * MATRIX_COLS + 3, r * MATRIX_COLS + 4, \
+                   r * MATRIX_COLS + 5, r * MATRIX_COLS + 6, r * MATRIX_COLS + 7, r * MATRIX_COLS + 8, r * MATRIX_COLS + 9
+#define LED_POINTS(y) {0, y}, {25, y}, {50, y}, {75, y}, {100, y}, {124, y}, {149, y}, {174, y}, {199, y}, {224, y}
+#define LED_FLAGS(f) f, f, f, f, f, f, f, f, f, f
+led_config_t g_led_config = {{
+    {LED_ROW(0)}, {LED_ROW(1)}, {LED_ROW(2)}, {LED_ROW(3)}
+}, {
+    LED_POINTS(0), LED_POINTS(21), LED_POINTS(43), LED_POINTS(64)
+}, {
+    LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_MODIFIER)
+}};
+// clang-format on
@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Two halves of 4x5 keys with a gap in the middle, where the outer column has no
+// LED, plus four underglow LEDs under each half.
+// Needs RGB_MATRIX_LED_COUNT set to 40.
+
+#pragma once
+
+// clang-format off
+#define LED_ROW(r) NO_LED, r * 8 + 0, r * 8 + 1, r * 8 + 2, r * 8 + 3, \
+                   r * 8 + 4, r * 8 + 5, r * 8 + 6, r * 8 + 7, NO_LED
+#define LED_POINTS(y) {20, y}, {40, y}, {60, y}, {80, y}, {144, y}, {164, y}, {184, y}, {204, y}
+#define LED_FLAGS(f) f, f, f, f, f, f, f, f
+led_config_t g_led_config = {{
+    {LED_ROW(0)}, {LED_ROW(1)}, {LED_ROW(2)}, {LED_ROW(3)}
+}, {
+    LED_POINTS(0), LED_POINTS(21), LED_POINTS(43), LED_POINTS(64),
+    {10, 10}, {90, 10}, {90, 54}, {10, 54}, {134, 10}, {214, 10}, {214, 54}, {134, 54}
+}, {
+    LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_KEYLIGHT), LED_FLAGS(LED_FLAG_MODIFIER),
+    LED_FLAGS(LED_FLAG_UNDERGLOW)
+}};
+// clang-format on
@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../config.h"
+
+#undef RGB_MATRIX_TEST_LAYOUT
+#undef RGB_MATRIX_LED_COUNT
+#define RGB_MATRIX_TEST_LAYOUT "layout_split_underglow.h"
+#define RGB_MATRIX_LED_COUNT 40
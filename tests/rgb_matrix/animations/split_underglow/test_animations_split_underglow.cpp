@@ -0,0 +1,6 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Same effects and checks as the animations test, on a layout with keys without
+// LEDs and underglow LEDs without keys.
+#include "../test_animations.cpp"
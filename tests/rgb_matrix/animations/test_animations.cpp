@@ -0,0 +1,252 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using testing::_;
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+
+static rgb_t    leds[RGB_MATRIX_LED_COUNT];
+static rgb_t    flushed[RGB_MATRIX_LED_COUNT];
+static unsigned hsv_to_rgb_calls = 0;
+
+static void test_init(void) {}
+
+static void test_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (rgb_t){red, green, blue};
+}
+
+static void test_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_set_color(i, red, green, blue);
+    }
+}
+
+static void test_flush(void) {
+    memcpy(flushed, leds, sizeof(flushed));
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush         = test_flush,
+};
+
+// The LED layout is picked by config.h, so the effects can be run against more than one
+#include RGB_MATRIX_TEST_LAYOUT
+
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
+    hsv_to_rgb_calls++;
+    return hsv_to_rgb(hsv);
+}
+}
+
+struct effect_t {
+    uint8_t     mode;
+    const char *name;
+};
+
+static const effect_t effects[] = {
+#define RGB_MATRIX_EFFECT(name, ...) {RGB_MATRIX_##name, #name},
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+// Simulated run for each effect: a key is hit every KEY_HIT_INTERVAL ms, and
+// the flushed frame is sampled every SAMPLE_INTERVAL ms.
+static const uint32_t RUN_TIME         = 2000;
+static const uint32_t SAMPLE_INTERVAL  = 200;
+static const uint32_t KEY_HIT_INTERVAL = 150;
+static const uint32_t KEY_HOLD_TIME    = 50;
+
+struct effect_run_t {
+    std::vector<std::vector<rgb_t>>     samples;
+    rgb_matrix_frame_stats_t            stats;
+    std::chrono::steady_clock::duration task_time;
+    unsigned                            hsv_to_rgb_calls;
+};
+
+class RgbMatrixAnimations : public TestFixture {
+   public:
+    effect_run_t run_effect(const effect_t &effect) {
+        effect_run_t run = {};
+
+        // Every effect starts from the same time, colour, speed and random seeds
+        timer_clear();
+        memset(leds, 0, sizeof(leds));
+        memset(flushed, 0, sizeof(flushed));
+        srand(1);
+        random16_set_seed(1337);
+        rgb_matrix_mode_noeeprom(effect.mode);
+        rgb_matrix_sethsv_noeeprom(100, 255, 255);
+        rgb_matrix_set_speed_noeeprom(128);
+        rgb_matrix_clear_frame_stats();
+        hsv_to_rgb_calls = 0;
+
+        for (uint32_t ms = 0; ms < RUN_TIME; ms++) {
+            uint32_t key = ms / KEY_HIT_INTERVAL;
+            if (ms % KEY_HIT_INTERVAL == 0 || ms % KEY_HIT_INTERVAL == KEY_HOLD_TIME) {
+                uint8_t row = (key * 3) % MATRIX_ROWS;
+                uint8_t col = (key * 7) % MATRIX_COLS;
+                rgb_matrix_handle_key_event(row, col, ms % KEY_HIT_INTERVAL == 0);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            rgb_matrix_task();
+            run.task_time += std::chrono::steady_clock::now() - start;
+
+            if (ms % SAMPLE_INTERVAL == SAMPLE_INTERVAL - 1) {
+                run.samples.emplace_back(flushed, flushed + RGB_MATRIX_LED_COUNT);
+            }
+            advance_time(1);
+        }
+
+        run.stats            = rgb_matrix_get_frame_stats();
+        run.hsv_to_rgb_calls = hsv_to_rgb_calls;
+        return run;
+    }
+};
+
+static uint32_t hash_frame(const std::vector<rgb_t> &frame) {
+    uint32_t hash = 2166136261u;
+    for (const rgb_t &led : frame) {
+        for (uint8_t byte : {led.r, led.g, led.b}) {
+            hash = (hash ^ byte) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+static std::string golden_path() {
+    // Next to the test being built, so each layout keeps its own hashes
+    std::string path = __BASE_FILE__;
+    return path.substr(0, path.find_last_of('/') + 1) + "golden_frames.txt";
+}
+
+static std::map<std::string, std::vector<uint32_t>> read_golden_frames() {
+    std::map<std::string, std::vector<uint32_t>> golden;
+    std::ifstream                                file(golden_path());
+    std::string                                  line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream    fields(line);
+        std::string           name;
+        std::vector<uint32_t> hashes;
+        uint32_t              hash;
+        fields >> name;
+        while (fields >> std::hex >> hash) {
+            hashes.push_back(hash);
+        }
+        golden[name] = hashes;
+    }
+    return golden;
+}
+
+// Writes the samples of an effect as a PPM image, one row per sample and one pixel per LED
+static void dump_frames(const char *dir, const effect_t &effect, const effect_run_t &run) {
+    std::ofstream image(std::string(dir) + "/" + effect.name + ".ppm", std::ios::binary);
+    image << "P6\n" << RGB_MATRIX_LED_COUNT << " " << run.samples.size() << "\n255\n";
+    for (const auto &frame : run.samples) {
+        for (const rgb_t &led : frame) {
+            image.put(led.r).put(led.g).put(led.b);
+        }
+    }
+}
+
+// Compares the sampled frames of every effect against golden_frames.txt. Set
+// RGB_MATRIX_UPDATE_GOLDEN to rewrite that file after an intended change, and
+// RGB_MATRIX_FRAME_DUMP to a directory to write the frames out as images.
+TEST_F(RgbMatrixAnimations, effects_match_golden_frames) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    auto        golden    = read_golden_frames();
+    const char *dump_dir  = getenv("RGB_MATRIX_FRAME_DUMP");
+    bool        update    = getenv("RGB_MATRIX_UPDATE_GOLDEN") != nullptr;
+    std::string rewritten = "# Frame hashes sampled by test_animations.cpp, regenerate with RGB_MATRIX_UPDATE_GOLDEN=1\n";
+
+    for (const effect_t &effect : effects) {
+        effect_run_t run = run_effect(effect);
+        if (dump_dir) {
+            dump_frames(dump_dir, effect, run);
+        }
+
+        std::vector<uint32_t> hashes;
+        char                  hex[10];
+        rewritten += effect.name;
+        for (const auto &frame : run.samples) {
+            hashes.push_back(hash_frame(frame));
+            snprintf(hex, sizeof(hex), " %08x", hashes.back());
+            rewritten += hex;
+        }
+        rewritten += "\n";
+
+        if (!update) {
+            ASSERT_TRUE(golden.count(effect.name)) << "no golden frames for " << effect.name;
+            const auto &expected = golden[effect.name];
+            ASSERT_EQ(expected.size(), hashes.size()) << effect.name;
+            for (size_t i = 0; i < hashes.size(); i++) {
+                EXPECT_EQ(expected[i], hashes[i]) << effect.name << " differs at " << (i + 1) * SAMPLE_INTERVAL << "ms";
+            }
+        }
+    }
+
+    if (update) {
+        std::ofstream(golden_path()) << rewritten;
+    }
+}
+
+// The frame counters are deterministic, so the cost of each effect is checked through them
+TEST_F(RgbMatrixAnimations, frame_counters_add_up) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    for (const effect_t &effect : effects) {
+        effect_run_t run = run_effect(effect);
+        EXPECT_GT(run.stats.frames, 0u) << effect.name;
+        EXPECT_EQ(run.stats.flushes + run.stats.flushes_skipped, run.stats.frames) << effect.name;
+        // A frame declared unchanged writes nothing, so it is never flushed
+        EXPECT_GE(run.stats.flushes_skipped, run.stats.frames_skipped) << effect.name;
+        // Every colour converted ends up written to an LED
+        EXPECT_LE(run.hsv_to_rgb_calls, run.stats.led_writes) << effect.name;
+    }
+}
+
+TEST_F(RgbMatrixAnimations, solid_color_only_draws_once) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    effect_run_t run = run_effect({RGB_MATRIX_SOLID_COLOR, "SOLID_COLOR"});
+    EXPECT_EQ(run.stats.frames_skipped, run.stats.frames - 1);
+    EXPECT_EQ(run.stats.led_writes, (uint32_t)RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(run.stats.flushes, 1u);
+}
+
+TEST_F(RgbMatrixAnimations, benchmark) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    for (const effect_t &effect : effects) {
+        effect_run_t run    = run_effect(effect);
+        double       ns     = std::chrono::duration<double, std::nano>(run.task_time).count();
+        unsigned     frames = run.stats.frames ? run.stats.frames : 1;
+        printf("[ BENCHMARK] rgb_matrix %-26s %8.0f ns/frame %8.0f LEDs/ms %6.1f LED writes/frame %6.1f hsv_to_rgb/frame %3u%% frames skipped\n", effect.name, ns / frames, ns ? run.stats.led_writes * 1e6 / ns : 0.0, (double)run.stats.led_writes / frames, (double)run.hsv_to_rgb_calls / frames, run.stats.frames_skipped * 100 / frames);
+    }
+}
@@ -0,0 +1,191 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "rgb_matrix.h"
+
+static rgb_t    leds[RGB_MATRIX_LED_COUNT];
+static unsigned flush_count = 0;
+
+static void test_init(void) {}
+
+static void test_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    leds[index] = (rgb_t){red, green, blue};
+}
+
+static void test_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_set_color(i, red, green, blue);
+    }
+}
+
+static void test_flush(void) {
+    flush_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush         = test_flush,
+};
+
+// clang-format off
+led_config_t g_led_config = {{
+    {0, 1, 2, 3, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+    {NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED, NO_LED},
+}, {
+    {0, 0}, {16, 0}, {32, 0}, {48, 0}
+}, {
+    4, 4, 4, 4
+}};
+// clang-format on
+
+static bool draw_indicator = false;
+
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    if (draw_indicator) {
+        RGB_MATRIX_INDICATOR_SET_COLOR(0, 1, 2, 3);
+    }
+    return false;
+}
+}
+
+// Long enough for several frames to be drawn and flushed
+static const uint32_t SEVERAL_FRAMES = RGB_MATRIX_LED_FLUSH_LIMIT * 10;
+
+class IncrementalRendering : public TestFixture {
+   public:
+    IncrementalRendering() {
+        draw_indicator = false;
+    }
+
+    void settle(uint8_t mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        rgb_matrix_sethsv_noeeprom(HSV_RED);
+        idle_for(SEVERAL_FRAMES);
+        rgb_matrix_clear_frame_stats();
+        flush_count = 0;
+    }
+};
+
+TEST_F(IncrementalRendering, solid_color_skips_unchanged_frames) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    idle_for(SEVERAL_FRAMES);
+    rgb_matrix_frame_stats_t stats = rgb_matrix_get_frame_stats();
+    EXPECT_GE(stats.frames, 5);
+    EXPECT_EQ(stats.frames_skipped, stats.frames);
+    EXPECT_EQ(stats.led_writes, 0);
+    EXPECT_EQ(stats.flushes, 0);
+    EXPECT_EQ(stats.flushes_skipped, stats.frames);
+    EXPECT_EQ(flush_count, 0);
+}
+
+TEST_F(IncrementalRendering, colour_change_redraws_once) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+    idle_for(SEVERAL_FRAMES);
+    rgb_matrix_frame_stats_t stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames - 1);
+    EXPECT_EQ(stats.led_writes, RGB_MATRIX_LED_COUNT);
+    EXPECT_EQ(flush_count, 1);
+
+    rgb_t blue = hsv_to_rgb((hsv_t){HSV_BLUE});
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(leds[i].b, blue.b);
+    }
+}
+
+TEST_F(IncrementalRendering, indicators_force_redraw) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    draw_indicator = true;
+    idle_for(SEVERAL_FRAMES);
+    rgb_matrix_frame_stats_t stats = rgb_matrix_get_frame_stats();
+    EXPECT_LE(stats.frames_skipped, 1);
+    EXPECT_EQ(leds[0].r, 1);
+    EXPECT_EQ(leds[0].g, 2);
+    EXPECT_EQ(leds[0].b, 3);
+
+    // Once the indicator stops, the effect redraws the LED underneath it
+    draw_indicator = false;
+    rgb_matrix_clear_frame_stats();
+    idle_for(SEVERAL_FRAMES);
+    stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames - 1);
+
+    rgb_t red = hsv_to_rgb((hsv_t){HSV_RED});
+    EXPECT_EQ(leds[0].r, red.r);
+    EXPECT_EQ(leds[0].g, red.g);
+    EXPECT_EQ(leds[0].b, red.b);
+}
+
+TEST_F(IncrementalRendering, reactive_redraws_until_hit_fades) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    settle(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+
+    idle_for(SEVERAL_FRAMES);
+    rgb_matrix_frame_stats_t stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    rgb_matrix_clear_frame_stats();
+    idle_for(SEVERAL_FRAMES);
+    stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, 0);
+    VERIFY_AND_CLEAR(driver);
+
+    // With the default speed a hit fades out within a second
+    idle_for(1000);
+    rgb_matrix_clear_frame_stats();
+    idle_for(SEVERAL_FRAMES);
+    stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames);
+}
+
+TEST_F(IncrementalRendering, heatmap_skips_frames_once_cooled_down) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+    settle(RGB_MATRIX_TYPING_HEATMAP);
+
+    idle_for(SEVERAL_FRAMES);
+    rgb_matrix_frame_stats_t stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    rgb_matrix_clear_frame_stats();
+    idle_for(SEVERAL_FRAMES);
+    stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, 0);
+    VERIFY_AND_CLEAR(driver);
+
+    // Heat decreases by one every RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS
+    idle_for(UINT8_MAX * RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+    rgb_matrix_clear_frame_stats();
+    idle_for(SEVERAL_FRAMES);
+    stats = rgb_matrix_get_frame_stats();
+    EXPECT_EQ(stats.frames_skipped, stats.frames);
+}
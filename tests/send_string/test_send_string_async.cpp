@@ -0,0 +1,162 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "quantum.h"
+#include "eeprom.h"
+}
+
+class SendStringAsync : public TestFixture {
+   public:
+    void TearDown() override {
+        send_string_async_cancel();
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(SendStringAsync, returns_before_typing) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async_with_delay("aB", 0));
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, limits_events_per_pass) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("abc", 0));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, interval_spreads_presses_over_passes) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("ab", 5));
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(15);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, matrix_is_scanned_during_delay) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key(0, 0, 0, KC_X);
+    set_keymap({key});
+
+    EXPECT_TRUE(send_string_async_with_delay("a" SS_DELAY(100) "b", 0));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, reports_full_queue) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    EXPECT_EQ(send_string_async_queue_free(), 2);
+    EXPECT_TRUE(send_string_async_with_delay("a", 0));
+    EXPECT_TRUE(send_string_async_with_delay("b", 0));
+    EXPECT_EQ(send_string_async_queue_free(), 0);
+    EXPECT_FALSE(send_string_async_with_delay("c", 0));
+
+    idle_for(10);
+    EXPECT_EQ(send_string_async_queue_free(), 2);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, types_from_progmem_and_eeprom) {
+    TestDriver driver;
+    InSequence s;
+
+    // The test EEPROM is only just big enough for eeconfig, so borrow its last bytes
+    static const char progmem_string[] PROGMEM = "1";
+    void             *eeprom_string            = (void *)(TOTAL_EEPROM_BYTE_COUNT - 2);
+    eeprom_update_block("2", eeprom_string, 2);
+
+    EXPECT_TRUE(send_string_async_with_delay_P(progmem_string, 0));
+    EXPECT_TRUE(send_string_async_with_delay_eeprom(eeprom_string, 0));
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, cancel_releases_held_keys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async_with_delay("A", 5));
+    EXPECT_TRUE(send_string_async_with_delay("b", 5));
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The A was never pressed, so only shift needs letting go of
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_busy());
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
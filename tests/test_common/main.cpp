@@ -1,3 +1,5 @@
+#include <cstdlib>
+#include <string>
 #include "gtest/gtest.h"
 
 extern "C" {
@@ -26,6 +28,14 @@ void init_logging(void) {
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
 
+    // Timed tests only print their results, so they are left out unless asked for
+    if (!getenv("QMK_TEST_BENCHMARK")) {
+        std::string filter = GTEST_FLAG_GET(filter);
+        filter += filter.find('-') == std::string::npos ? "-" : ":";
+        filter += "*.benchmark*";
+        GTEST_FLAG_SET(filter, filter);
+    }
+
     init_logging();
 
     return RUN_ALL_TESTS();
@@ -18,6 +18,10 @@
 #include "test_matrix.h"
 #include <string.h>
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
 void matrix_init(void) {
@@ -42,10 +46,17 @@ void matrix_scan_kb(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= (matrix_row_t)1 << col;
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Stands in for the pin change interrupt of a real matrix
+    idle_scheduler_wake();
+#endif
 }
 
 void release_key(uint8_t col, uint8_t row) {
     matrix[row] &= ~((matrix_row_t)1 << col);
+#ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_wake();
+#endif
 }
 
 bool matrix_is_on(uint8_t row, uint8_t col) {
@@ -23,6 +23,9 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -59,6 +62,9 @@ void TestFixture::TearDownTestCase() {}
 TestFixture::TestFixture() {
     m_this = this;
     timer_clear();
+#ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_init();
+#endif
     keyrecord_t empty_keyrecord = {0};
     test_logger.info() << "tapping term is " << +GET_TAPPING_TERM(KC_TRANSPARENT, &empty_keyrecord) << "ms" << std::endl;
 }
@@ -179,6 +185,14 @@ void TestFixture::run_one_scan_loop() {
 void TestFixture::idle_for(unsigned time) {
     test_logger.trace() << +time << " keyboard task " << (time > 1 ? "loops" : "loop") << std::endl;
     for (unsigned i = 0; i < time; i++) {
+#ifdef IDLE_SCHEDULER_ENABLE
+        // Skip the passes the scheduler would have slept through
+        if (!idle_scheduler_is_due()) {
+            advance_time(1);
+            continue;
+        }
+        idle_scheduler_begin_pass();
+#endif
         keyboard_task();
         housekeeping_task();
         advance_time(1);
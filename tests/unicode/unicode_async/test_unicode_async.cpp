@@ -0,0 +1,172 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class UnicodeAsync : public TestFixture {};
+
+TEST_F(UnicodeAsync, returns_before_typing) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t start = timer_read32();
+    register_unicode(0x03A8); // Ψ
+    EXPECT_EQ(timer_read32(), start);
+    EXPECT_TRUE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_UNICODE(driver, 0x03A8);
+    idle_for(UNICODE_TYPE_DELAY + 2);
+    EXPECT_FALSE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, keys_wait_for_code_point) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key(0, 0, 0, KC_X);
+    set_keymap({key});
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    register_unicode(0x2013); // –
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT, KC_U));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Held back until the code point is finished
+    EXPECT_NO_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_0));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(UNICODE_TYPE_DELAY + 2);
+    EXPECT_FALSE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, keys_land_between_code_points) {
+    TestDriver driver;
+    KeymapKey  key(0, 0, 0, KC_X);
+    set_keymap({key});
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    {
+        InSequence s;
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_REPORT(driver, (KC_X));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_UNICODE(driver, 0x03A8);
+    }
+    send_unicode_string("ΨΨ");
+    run_one_scan_loop();
+    tap_key(key);
+    idle_for(2 * (UNICODE_TYPE_DELAY + 2));
+    EXPECT_FALSE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, keeps_mods_set_during_code_point) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    register_unicode(0x03A8); // Ψ
+    run_one_scan_loop();
+    EXPECT_TRUE(unicode_holds_input());
+
+    // Set by something other than a key event, e.g. a deferred callback
+    register_mods(MOD_BIT(KC_RIGHT_ALT));
+    idle_for(UNICODE_TYPE_DELAY + 2);
+    EXPECT_FALSE(unicode_busy());
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_RIGHT_ALT));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, long_string_does_not_block) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    // Longer than fits in the queue at once
+    const char *string = "🧙🧙🧙🧙🧙🧙🧙🧙🧙🧙";
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t start = timer_read32();
+    send_unicode_string(string);
+    EXPECT_EQ(timer_read32(), start);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        for (int i = 0; i < 10; i++) {
+            EXPECT_UNICODE(driver, 0x1F9D9);
+        }
+    }
+    idle_for(10 * (UNICODE_TYPE_DELAY + 2));
+    EXPECT_FALSE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, keeps_order_after_string) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    {
+        InSequence s;
+        for (int i = 0; i < 4; i++) {
+            EXPECT_UNICODE(driver, 0x1F9D9);
+        }
+        EXPECT_UNICODE(driver, 0x03A8);
+    }
+    send_unicode_string("🧙🧙🧙🧙");
+    register_unicode(0x03A8);
+    idle_for(5 * (UNICODE_TYPE_DELAY + 2));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, flush_types_everything) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    // Alt+D83EDDD9 🧙
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        for (uint8_t kc : {KC_D, KC_8, KC_3, KC_E, KC_D, KC_D, KC_D, KC_9}) {
+            EXPECT_REPORT(driver, (kc, KC_LEFT_ALT));
+            EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    register_unicode(0x1F9D9);
+    unicode_flush();
+    EXPECT_FALSE(unicode_busy());
+    VERIFY_AND_CLEAR(driver);
+}
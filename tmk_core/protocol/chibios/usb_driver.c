@@ -12,6 +12,10 @@
 #include "usb_driver.h"
 #include "util.h"
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
 /*===========================================================================*/
 /* Driver local functions.                                                   */
 /*===========================================================================*/
@@ -248,6 +252,11 @@ void usb_endpoint_out_rx_complete_cb(USBDriver *usbp, usbep_t ep) {
     usb_start_receive(endpoint);
 
     osalSysUnlockFromISR();
+
+#ifdef IDLE_SCHEDULER_ENABLE
+    // Hand the received data to the main loop without waiting for its next pass
+    idle_scheduler_wake();
+#endif
 }
 
 bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size_t size, sysinterval_t timeout, bool buffered) {
@@ -26,6 +26,9 @@
 #    include "led.h"
 #endif
 #include "wait.h"
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 #include "usb_endpoints.h"
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
@@ -113,6 +116,9 @@ static inline bool usb_event_queue_enqueue(usbevent_t event) {
     }
     event_queue[event_queue_head] = event;
     event_queue_head              = next;
+#ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_wake();
+#endif
     return true;
 }
 
@@ -443,11 +449,15 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
 }
 
 void send_keyboard(report_keyboard_t *report) {
+    bool sent;
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
+        sent = send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
     } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        sent = send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+    }
+    if (!sent) {
+        host_keyboard_report_dropped();
     }
 }
 
@@ -35,6 +35,33 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "outputselect.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
+#ifdef KEYBOARD_REPORT_SCHEDULER
+#    include <string.h>
+#    include "timer.h"
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        include "idle_scheduler.h"
+#    endif
+
+#    ifndef KEYBOARD_REPORT_QUEUE_SIZE
+#        define KEYBOARD_REPORT_QUEUE_SIZE 8
+#    endif
+
+// Minimum time between keyboard reports, matching the endpoint's bInterval
+#    ifndef KEYBOARD_REPORT_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define KEYBOARD_REPORT_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define KEYBOARD_REPORT_INTERVAL 1
+#        endif
+#    endif
+
+_Static_assert(KEYBOARD_REPORT_QUEUE_SIZE > 0 && KEYBOARD_REPORT_QUEUE_SIZE <= 255, "KEYBOARD_REPORT_QUEUE_SIZE must be between 1 and 255");
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 extern keymap_config_t keymap_config;
@@ -44,6 +71,17 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+static host_keyboard_report_stats_t keyboard_report_stats = {0};
+
+#ifdef KEYBOARD_REPORT_SCHEDULER
+static report_keyboard_t report_queue[KEYBOARD_REPORT_QUEUE_SIZE];
+static uint8_t           report_queue_head  = 0;
+static uint8_t           report_queue_count = 0;
+static report_keyboard_t last_sent_report   = {0};
+static uint32_t          last_sent_time     = 0;
+static bool              report_sent_once   = false;
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
 }
@@ -71,6 +109,138 @@ led_t host_keyboard_led_state(void) {
     return (led_t)host_keyboard_leds();
 }
 
+static void host_keyboard_send_now(report_keyboard_t *report) {
+    (*driver->send_keyboard)(report);
+    keyboard_report_stats.sent++;
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_sent();
+#endif
+#ifdef KEYBOARD_REPORT_SCHEDULER
+    last_sent_report = *report;
+    last_sent_time   = timer_read32();
+    report_sent_once = true;
+#endif
+
+    if (debug_keyboard) {
+        dprintf("keyboard_report: %02X | ", report->mods);
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            dprintf("%02X ", report->keys[i]);
+        }
+        dprint("\n");
+    }
+}
+
+#ifdef KEYBOARD_REPORT_SCHEDULER
+/* Keyboard report scheduler
+ *
+ * The host only collects one report per polling interval, so reports sent
+ * faster than that pile up in the endpoint, and once it is full the driver
+ * blocks or gives up. Instead, the first report of a burst is sent straight
+ * away, and the rest are queued and sent one per KEYBOARD_REPORT_INTERVAL.
+ *
+ * While a report is still queued it can be replaced by the next one, as long as
+ * the host ends up seeing the same sequence of key presses: the report being
+ * replaced must not press a key (which could change the order keys are pressed
+ * in, or the modifiers they are pressed with), and no key or modifier may change
+ * both going into it and coming out of it (which would lose a tap).
+ */
+
+static bool report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Returns whether `current` can be left out between `previous` and `next` without the host noticing. */
+static bool report_can_merge(const report_keyboard_t *previous, const report_keyboard_t *current, const report_keyboard_t *next) {
+    if ((previous->mods ^ current->mods) & (current->mods ^ next->mods)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        // Pressed here for the first time
+        if (current->keys[i] && !report_has_key(previous, current->keys[i])) {
+            return false;
+        }
+        // Released here, then pressed again
+        if (previous->keys[i] && !report_has_key(current, previous->keys[i]) && report_has_key(next, previous->keys[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool report_interval_elapsed(void) {
+    return !report_sent_once || timer_elapsed32(last_sent_time) >= KEYBOARD_REPORT_INTERVAL;
+}
+
+static report_keyboard_t *report_queue_at(uint8_t index) {
+    return &report_queue[(report_queue_head + index) % KEYBOARD_REPORT_QUEUE_SIZE];
+}
+
+static void report_queue_send_head(void) {
+    host_keyboard_send_now(report_queue_at(0));
+    report_queue_head = (report_queue_head + 1) % KEYBOARD_REPORT_QUEUE_SIZE;
+    report_queue_count--;
+}
+
+static void host_keyboard_queue(report_keyboard_t *report) {
+    if (!report_queue_count && report_interval_elapsed()) {
+        host_keyboard_send_now(report);
+        return;
+    }
+
+    while (report_queue_count) {
+        report_keyboard_t *previous = report_queue_count > 1 ? report_queue_at(report_queue_count - 2) : &last_sent_report;
+        if (!report_can_merge(previous, report_queue_at(report_queue_count - 1), report)) {
+            break;
+        }
+        report_queue_count--;
+        keyboard_report_stats.merged++;
+    }
+
+    if (report_queue_count == KEYBOARD_REPORT_QUEUE_SIZE) {
+        // Out of room: hand the oldest to the driver early rather than lose it
+        report_queue_send_head();
+    }
+    memcpy(report_queue_at(report_queue_count), report, sizeof(report_keyboard_t));
+    report_queue_count++;
+}
+
+void host_keyboard_report_task(void) {
+    if (!report_queue_count) {
+        return;
+    }
+    if (report_interval_elapsed()) {
+        report_queue_send_head();
+    }
+#    ifdef IDLE_SCHEDULER_ENABLE
+    if (report_queue_count) {
+        idle_scheduler_wake_at(last_sent_time + KEYBOARD_REPORT_INTERVAL);
+    }
+#    endif
+}
+
+void host_keyboard_report_flush(void) {
+    while (report_queue_count) {
+        report_queue_send_head();
+    }
+}
+
+bool host_keyboard_report_pending(void) {
+    return report_queue_count;
+}
+#endif
+
+/** \brief Sends any queued keyboard reports ahead of a report of another type, so the host sees them in the order they were made. */
+static inline void host_report_order_barrier(void) {
+#ifdef KEYBOARD_REPORT_SCHEDULER
+    host_keyboard_report_flush();
+#endif
+}
+
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
 #ifdef BLUETOOTH_ENABLE
@@ -84,21 +254,29 @@ void host_keyboard_send(report_keyboard_t *report) {
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
-    (*driver->send_keyboard)(report);
+#ifdef KEYBOARD_REPORT_SCHEDULER
+    host_keyboard_queue(report);
+#else
+    host_keyboard_send_now(report);
+#endif
+}
 
-    if (debug_keyboard) {
-        dprintf("keyboard_report: %02X | ", report->mods);
-        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-            dprintf("%02X ", report->keys[i]);
-        }
-        dprint("\n");
-    }
+void host_keyboard_report_dropped(void) {
+    keyboard_report_stats.dropped++;
+}
+
+host_keyboard_report_stats_t host_keyboard_report_stats(void) {
+    return keyboard_report_stats;
 }
 
 void host_nkro_send(report_nkro_t *report) {
     if (!driver) return;
+    host_report_order_barrier();
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report_sent();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -118,6 +296,7 @@ void host_mouse_send(report_mouse_t *report) {
 #endif
 
     if (!driver) return;
+    host_report_order_barrier();
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
 #endif
@@ -134,6 +313,7 @@ void host_system_send(uint16_t usage) {
     last_system_usage = usage;
 
     if (!driver) return;
+    host_report_order_barrier();
 
     report_extra_t report = {
         .report_id = REPORT_ID_SYSTEM,
@@ -154,6 +334,7 @@ void host_consumer_send(uint16_t usage) {
 #endif
 
     if (!driver) return;
+    host_report_order_barrier();
 
     report_extra_t report = {
         .report_id = REPORT_ID_CONSUMER,
@@ -215,6 +396,7 @@ void host_joystick_send(joystick_t *joystick) {
 #    endif
     };
 
+    host_report_order_barrier();
     send_joystick(&report);
 }
 #endif
@@ -234,6 +416,7 @@ void host_digitizer_send(digitizer_t *digitizer) {
         .y        = (uint16_t)(digitizer->y * 0x7FFF),
     };
 
+    host_report_order_barrier();
     send_digitizer(&report);
 }
 #endif
@@ -247,6 +430,7 @@ void host_programmable_button_send(uint32_t data) {
         .usage     = data,
     };
 
+    host_report_order_barrier();
     send_programmable_button(&report);
 }
 #endif
@@ -27,6 +27,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 extern "C" {
 #endif
 
+typedef struct {
+    uint16_t sent;    // Keyboard reports handed to the driver
+    uint16_t merged;  // Queued keyboard reports replaced by a later one
+    uint16_t dropped; // Keyboard reports the driver failed to send
+} host_keyboard_report_stats_t;
+
 /* host driver */
 void           host_set_driver(host_driver_t *driver);
 host_driver_t *host_get_driver(void);
@@ -44,6 +50,16 @@ void    host_programmable_button_send(uint32_t data);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+/* keyboard report statistics */
+void                         host_keyboard_report_dropped(void);
+host_keyboard_report_stats_t host_keyboard_report_stats(void);
+
+#ifdef KEYBOARD_REPORT_SCHEDULER
+void host_keyboard_report_task(void);
+void host_keyboard_report_flush(void);
+bool host_keyboard_report_pending(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -81,10 +81,10 @@ static void   send_mouse(report_mouse_t *report);
 static void   send_extra(report_extra_t *report);
 host_driver_t lufa_driver = {.keyboard_leds = usb_device_state_get_leds, .send_keyboard = send_keyboard, .send_nkro = send_nkro, .send_mouse = send_mouse, .send_extra = send_extra};
 
-void send_report(uint8_t endpoint, void *report, size_t size) {
+bool send_report(uint8_t endpoint, void *report, size_t size) {
     uint8_t timeout = 255;
 
-    if (USB_DeviceState != DEVICE_STATE_Configured) return;
+    if (USB_DeviceState != DEVICE_STATE_Configured) return false;
 
     Endpoint_SelectEndpoint(endpoint);
 
@@ -92,10 +92,11 @@ void send_report(uint8_t endpoint, void *report, size_t size) {
     while (timeout-- && !Endpoint_IsReadWriteAllowed()) {
         _delay_us(40);
     }
-    if (!Endpoint_IsReadWriteAllowed()) return;
+    if (!Endpoint_IsReadWriteAllowed()) return false;
 
     Endpoint_Write_Stream_LE(report, size, NULL);
     Endpoint_ClearIN();
+    return true;
 }
 
 #ifdef VIRTSER_ENABLE
@@ -523,11 +524,15 @@ void EVENT_USB_Device_ControlRequest(void) {
  * FIXME: Needs doc
  */
 static void send_keyboard(report_keyboard_t *report) {
+    bool sent;
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(KEYBOARD_IN_EPNUM, &report->mods, 8);
+        sent = send_report(KEYBOARD_IN_EPNUM, &report->mods, 8);
     } else {
-        send_report(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE);
+        sent = send_report(KEYBOARD_IN_EPNUM, report, KEYBOARD_REPORT_SIZE);
+    }
+    if (!sent) {
+        host_keyboard_report_dropped();
     }
 
     keyboard_report_sent = *report;